@@ -63,6 +63,15 @@
 /* Define to 1 if you have the 'scandir' function. */
 #cmakedefine HAVE_SCANDIR 1
 
+/* Define to 1 if you have the 'mlockall' function. */
+#cmakedefine HAVE_MLOCKALL 1
+
+/* Define to 1 if you have the 'pthread_setaffinity_np' function. */
+#cmakedefine HAVE_PTHREAD_SETAFFINITY_NP 1
+
+/* Define to 1 if you have the 'pthread_setschedparam' function. */
+#cmakedefine HAVE_PTHREAD_SETSCHEDPARAM 1
+
 /* Define to 1 if you have the 'strdup' function */
 #cmakedefine HAVE_STRDUP 1
 
@@ -27,19 +27,28 @@ static Uint8         recBuffer[1<<REC_BUFFER_SZ];
 static Uint32        recBufferWr         = 0;
 static Uint32        recBufferRd         = 0;
 static lock_t        recBufferLock;
+#define              PLAY_BUFFER_SZ      18  /* Playback buffer size in power of two */
+static const  Uint32 PLAY_BUFFER_MASK    = (1<<PLAY_BUFFER_SZ) - 1;
+static Uint8         playBuffer[1<<PLAY_BUFFER_SZ];
+static Uint32        playBufferWr        = 0; /* free running byte counters */
+static Uint32        playBufferRd        = 0;
+static lock_t        playBufferLock;
 
 void Audio_Output_Queue(Uint8* data, int len) {
-    int chunkSize = AUDIO_BUFFER_SAMPLES;
-    while(len > 0) {
-        if(len < chunkSize) chunkSize = len;
-        SDL_QueueAudio(Audio_Output_Device, data, chunkSize);
-        data += chunkSize;
-        len  -= chunkSize;
-    }
+    host_lock(&playBufferLock);
+    if(len > (int)(sizeof(playBuffer) - (playBufferWr - playBufferRd)))
+        len = sizeof(playBuffer) - (playBufferWr - playBufferRd); /* drop overflow */
+    while(len-- > 0)
+        playBuffer[playBufferWr++&PLAY_BUFFER_MASK] = *data++;
+    host_unlock(&playBufferLock);
 }
 
 Uint32 Audio_Output_Queue_Size() {
-    return SDL_GetQueuedAudioSize(Audio_Output_Device) / 4;
+    Uint32 size;
+    host_lock(&playBufferLock);
+    size = playBufferWr - playBufferRd;
+    host_unlock(&playBufferLock);
+    return size / 4;
 }
 
 /*-----------------------------------------------------------------------*/
@@ -48,7 +57,28 @@ Uint32 Audio_Output_Queue_Size() {
  * Note: These functions will run in a separate thread.
  */
 
+static void Audio_Output_CallBack(void *userdata, Uint8 *stream, int len) {
+    static SDL_threadID audioThread = 0;
+    if(audioThread != SDL_ThreadID()) {
+        audioThread = SDL_ThreadID();
+        host_thread_setup(THREAD_AUDIO);
+    }
+    host_lock(&playBufferLock);
+    while(len > 0 && playBufferRd != playBufferWr) {
+        *stream++ = playBuffer[playBufferRd++&PLAY_BUFFER_MASK];
+        len--;
+    }
+    host_unlock(&playBufferLock);
+    if(len > 0)
+        memset(stream, 0, len); /* underrun, play silence */
+}
+
 static void Audio_Input_CallBack(void *userdata, Uint8 *stream, int len) {
+    static SDL_threadID audioThread = 0;
+    if(audioThread != SDL_ThreadID()) {
+        audioThread = SDL_ThreadID();
+        host_thread_setup(THREAD_AUDIO);
+    }
     Log_Printf(LOG_WARN, "Audio_Input_CallBack %d", len);
     if(len == 0) return;
     Audio_Input_Lock();
@@ -57,6 +87,7 @@ static void Audio_Input_CallBack(void *userdata, Uint8 *stream, int len) {
 	recBufferWr &= REC_BUFFER_MASK;
 	recBufferWr &= ~1; /* Just to be sure */
     Audio_Input_Unlock();
+    host_wake(); /* wake up 68k if it sleeps in STOP */
 }
 
 void Audio_Input_Lock() {
@@ -126,10 +157,11 @@ void Audio_Output_Init(void)
     request.freq     = AUDIO_OUT_FREQUENCY; /* 44,1 kHz */
     request.format   = AUDIO_S16MSB;        /* 16-Bit signed, big endian */
     request.channels = 2;                   /* stereo */
-    request.callback = NULL;
+    request.callback = Audio_Output_CallBack;
     request.userdata = NULL;
     request.samples  = AUDIO_BUFFER_SAMPLES; /* buffer size in samples */
 
+    playBufferWr = playBufferRd = 0;
     Audio_Output_Device = SDL_OpenAudioDevice(NULL, 0, &request, &granted, 0);
     if (Audio_Output_Device==0)	/* Open audio device */ {
         Log_Printf(LOG_WARN, "[Audio] Can't use audio: %s\n", SDL_GetError());
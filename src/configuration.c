@@ -61,6 +61,8 @@ static const struct Config_Tag configs_Screen[] =
 	{ "bFullScreen", Bool_Tag, &ConfigureParams.Screen.bFullScreen },
 	{ "bShowStatusbar", Bool_Tag, &ConfigureParams.Screen.bShowStatusbar },
 	{ "bShowDriveLed", Bool_Tag, &ConfigureParams.Screen.bShowDriveLed },
+	{ "bVsyncLock", Bool_Tag, &ConfigureParams.Screen.bVsyncLock },
+	{ "nVsyncTolerance", Int_Tag, &ConfigureParams.Screen.nVsyncTolerance },
 	{ NULL , Error_Tag, NULL }
 };
 
@@ -270,12 +272,24 @@ static const struct Config_Tag configs_System[] =
 	{ "nCpuFreq", Int_Tag, &ConfigureParams.System.nCpuFreq },
 	{ "bCompatibleCpu", Bool_Tag, &ConfigureParams.System.bCompatibleCpu },
 	{ "bRealtime", Bool_Tag, &ConfigureParams.System.bRealtime },
+	{ "bIdleWarp", Bool_Tag, &ConfigureParams.System.bIdleWarp },
+	{ "bThreadedDispatch", Bool_Tag, &ConfigureParams.System.bThreadedDispatch },
+	{ "nCoprocQuantum", Int_Tag, &ConfigureParams.System.nCoprocQuantum },
+	{ "nSpeedTarget", Int_Tag, &ConfigureParams.System.nSpeedTarget },
 	{ "nDSPType", Int_Tag, &ConfigureParams.System.nDSPType },
 	{ "bDSPMemoryExpansion", Bool_Tag, &ConfigureParams.System.bDSPMemoryExpansion },
 	{ "bRealTimeClock", Bool_Tag, &ConfigureParams.System.bRealTimeClock },
     { "n_FPUType", Int_Tag, &ConfigureParams.System.n_FPUType },
     { "bCompatibleFPU", Bool_Tag, &ConfigureParams.System.bCompatibleFPU },
     { "bMMU", Bool_Tag, &ConfigureParams.System.bMMU },
+	{ "nSchedPolicy", Int_Tag, &ConfigureParams.System.nSchedPolicy },
+	{ "nSchedPriority", Int_Tag, &ConfigureParams.System.nSchedPriority },
+	{ "nCpuCore", Int_Tag, &ConfigureParams.System.nThreadCore[THREAD_CPU] },
+	{ "nI860Core", Int_Tag, &ConfigureParams.System.nThreadCore[THREAD_I860] },
+	{ "nRenderCore", Int_Tag, &ConfigureParams.System.nThreadCore[THREAD_RENDER] },
+	{ "nAudioCore", Int_Tag, &ConfigureParams.System.nThreadCore[THREAD_AUDIO] },
+	{ "nSlirpCore", Int_Tag, &ConfigureParams.System.nThreadCore[THREAD_SLIRP] },
+	{ "bLockMemory", Bool_Tag, &ConfigureParams.System.bLockMemory },
     { NULL , Error_Tag, NULL }
 };
 
@@ -410,6 +424,8 @@ void Configuration_SetDefault(void)
 	ConfigureParams.Screen.nMonitorType = MONITOR_TYPE_CPU;
 	ConfigureParams.Screen.bShowStatusbar = true;
 	ConfigureParams.Screen.bShowDriveLed = true;
+	ConfigureParams.Screen.bVsyncLock = false;
+	ConfigureParams.Screen.nVsyncTolerance = 15;
 
 	/* Set defaults for Sound */
     ConfigureParams.Sound.bEnableMicrophone = true;
@@ -436,12 +452,21 @@ void Configuration_SetDefault(void)
 	ConfigureParams.System.nCpuFreq = 25;
 	ConfigureParams.System.bCompatibleCpu = true;
 	ConfigureParams.System.bRealtime = false;
+	ConfigureParams.System.bIdleWarp = false;
+	ConfigureParams.System.bThreadedDispatch = true;
+	ConfigureParams.System.nCoprocQuantum = 64;
+	ConfigureParams.System.nSpeedTarget = 0;
 	ConfigureParams.System.nDSPType = DSP_TYPE_EMU;
 	ConfigureParams.System.bDSPMemoryExpansion = false;
 	ConfigureParams.System.bRealTimeClock = true;
     ConfigureParams.System.n_FPUType = FPU_68882;
     ConfigureParams.System.bCompatibleFPU = true;
     ConfigureParams.System.bMMU = true;
+	ConfigureParams.System.nSchedPolicy = SCHED_POLICY_OTHER;
+	ConfigureParams.System.nSchedPriority = 10;
+	for (i = 0; i < THREAD_COUNT; i++)
+		ConfigureParams.System.nThreadCore[i] = -1;
+	ConfigureParams.System.bLockMemory = false;
     
     /* Set defaults for Dimension */
     ConfigureParams.Dimension.bI860Thread        = host_num_cpus() > 4;
@@ -495,6 +520,12 @@ void Configuration_Apply(bool bReset) {
     Configuration_CheckFloatMinMax(&ConfigureParams.Mouse.fExpSpeedNormal,MOUSE_EXP_MIN,MOUSE_EXP_MAX);
     Configuration_CheckFloatMinMax(&ConfigureParams.Mouse.fExpSpeedLocked,MOUSE_EXP_MIN,MOUSE_EXP_MAX);
     
+    /* Vsync lock tolerance in percent */
+    if (ConfigureParams.Screen.nVsyncTolerance < 0)
+        ConfigureParams.Screen.nVsyncTolerance = 0;
+    if (ConfigureParams.Screen.nVsyncTolerance > 50)
+        ConfigureParams.Screen.nVsyncTolerance = 50;
+    
     /* Check/constrain CPU settings and change corresponding
      * UAE cpu_level & cpu_compatible variables */
     M68000_CheckCpuSettings();
@@ -56,6 +56,14 @@ int quit_program;  // declared as "int quit_program = 0;" in main.c
 #define STATIC_INLINE static inline
 #endif
 
+#ifndef NOINLINE
+#if defined(__GNUC__)
+#define NOINLINE __attribute__ ((noinline))
+#else
+#define NOINLINE
+#endif
+#endif
+
 #define _vsnprintf vsnprintf
 #define _tcsncmp strncmp
 #define _istspace isspace
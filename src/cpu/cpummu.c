@@ -47,6 +47,8 @@
 uae_u32 mmu_is_super;
 uae_u32 mmu_tagmask, mmu_pagemask, mmu_pagemaski;
 struct mmu_atc_line mmu_atc_array[ATC_TYPE][ATC_WAYS][ATC_SLOTS];
+struct mmu_tlb_entry mmu_tlb[2][ATC_TYPE][MMU_TLB_SLOTS];
+static uae_u32 mmu_atc_gen;
 bool mmu_pagesize_8k;
 
 int mmu060_state;
@@ -69,6 +71,7 @@ uaecptr icache_uaddr[M68K_ICACHE_SZ];
 void flush_icache(uaecptr addr, int n) {
     memset(icache_saddr, 0xFF, sizeof(icache_saddr));
     memset(icache_uaddr, 0xFF, sizeof(icache_uaddr));
+    flush_decoded_blocks();
 }
 
 static void mmu_dump_ttr(const TCHAR * label, uae_u32 ttr)
@@ -108,6 +111,7 @@ void mmu_make_transparent_region(uaecptr baseaddr, uae_u32 size, int datamode)
 	*ttr = baseaddr & MMU_TTR_LOGICAL_BASE;
 	*ttr |= ((baseaddr + size - 1) & MMU_TTR_LOGICAL_BASE) >> 8;
 	*ttr |= MMU_TTR_BIT_ENABLED;
+	mmu_flush_tlb();
 
 #if MMUDEBUG > 0
 	write_log(_T("MMU: map transparent mapping of %08x\n"), *ttr);
@@ -117,6 +121,12 @@ void mmu_make_transparent_region(uaecptr baseaddr, uae_u32 size, int datamode)
 void mmu_tt_modified (void)
 {
 	mmu_ttr_enabled = ((regs.dtt0 | regs.dtt1 | regs.itt0 | regs.itt1) & MMU_TTR_BIT_ENABLED) != 0;
+	mmu_flush_tlb();
+}
+
+void mmu_flush_tlb(void)
+{
+	memset(mmu_tlb, 0, sizeof(mmu_tlb));
 }
 
 
@@ -270,6 +280,38 @@ static ALWAYS_INLINE int mmu_get_fc(bool super, bool data)
 	return (super ? 4 : 0) | (data ? 1 : 2);
 }
 
+/* Fault state of an access that is split into several bus cycles, or a
+ * MOVES access. It used to be set up by CATCH blocks around the accesses;
+ * mmu_bus_error() now applies it before throwing, so the accessors do not
+ * need a setjmp when nothing faults. Hardware bus errors get there too,
+ * through M68000_BusError() and exception2(). */
+#define SPLIT_NOTFIRST	1	/* misalignednotfirst() */
+#define SPLIT_CHECK	2	/* misalignednotfirstcheck() */
+#define SPLIT_WB3	4	/* write back the whole value */
+static int mmu_split_flags;
+static uaecptr mmu_split_addr;
+static uae_u32 mmu_split_val;
+
+static ALWAYS_INLINE void mmu_split_begin(uaecptr addr, uae_u32 val, int flags)
+{
+	mmu_split_addr = addr;
+	mmu_split_val = val;
+	mmu_split_flags = flags;
+}
+
+static ALWAYS_INLINE void mmu_split_end(void)
+{
+	mmu_split_flags = 0;
+}
+
+/* Drop a record left over from an access that was unwound by the run loop */
+void mmu_split_clear(void)
+{
+	mmu_split_flags = 0;
+}
+
+static void mmu_split_fault(void);
+
 void mmu_bus_error(uaecptr addr, int fc, bool write, int size, bool rmw, uae_u32 status, bool nonmmu)
 {
 	if (currprefs.mmu_model == 68040) {
@@ -397,6 +439,9 @@ void mmu_bus_error(uaecptr addr, int fc, bool write, int size, bool rmw, uae_u32
 
 	regs.mmu_fault_addr = addr;
 
+	if (mmu_split_flags)
+		mmu_split_fault();
+
 	THROW(2);
 }
 
@@ -418,6 +463,7 @@ void mmu_bus_error_ttr_write_fault(uaecptr addr, bool super, bool data, uae_u32
 static uaecptr mmu_fill_atc(uaecptr addr, bool super, bool data, bool write, struct mmu_atc_line *l, uae_u32 *status)
 {
 	uae_u32 desc;
+	int split_flags = mmu_split_flags;
 
 	*status = 0;
 	SAVE_EXCEPTION;
@@ -430,6 +476,8 @@ static uaecptr mmu_fill_atc(uaecptr addr, bool super, bool data, bool write, str
 	}
 	CATCH(prb) {
 		RESTORE_EXCEPTION;
+		/* still needed for the fault of the access itself */
+		mmu_split_flags = split_flags;
 		/* bus error during table search */
 		desc = 0;
 		*status = MMU_FSLW_TWE;
@@ -447,6 +495,7 @@ static uaecptr mmu_fill_atc(uaecptr addr, bool super, bool data, bool write, str
 		l->global = 0;
 	} else {
 		l->valid = 1;
+		l->gen = ++mmu_atc_gen;
 		l->phys = desc & mmu_pagemaski;
 		l->global = (desc & MMU_MMUSR_G) != 0;
 		l->modified = (desc & MMU_MMUSR_M) != 0;
@@ -617,21 +666,27 @@ static void misalignednotfirstcheck(uaecptr addr)
 	misalignednotfirst (addr);
 }
 
+static void mmu_split_fault(void)
+{
+	int flags = mmu_split_flags;
+
+	mmu_split_flags = 0;
+	if (flags & SPLIT_WB3)
+		regs.wb3_data = mmu_split_val;
+	if (flags & SPLIT_NOTFIRST)
+		misalignednotfirst(mmu_split_addr);
+	if (flags & SPLIT_CHECK)
+		misalignednotfirstcheck(mmu_split_addr);
+}
+
 uae_u16 REGPARAM2 mmu_get_word_unaligned(uaecptr addr, bool data, bool rmw)
 {
 	uae_u16 res;
 
 	res = (uae_u16)mmu_get_byte(addr, data, sz_word, rmw) << 8;
-	SAVE_EXCEPTION;
-	TRY(prb) {
-		res |= mmu_get_byte(addr + 1, data, sz_word, rmw);
-		RESTORE_EXCEPTION;
-	}
-	CATCH(prb) {
-		RESTORE_EXCEPTION;
-		misalignednotfirst(addr);
-		THROW_AGAIN(prb);
-	} ENDTRY
+	mmu_split_begin(addr, 0, SPLIT_NOTFIRST);
+	res |= mmu_get_byte(addr + 1, data, sz_word, rmw);
+	mmu_split_end();
 	return res;
 }
 
@@ -641,30 +696,16 @@ uae_u32 REGPARAM2 mmu_get_long_unaligned(uaecptr addr, bool data, bool rmw)
 
 	if (likely(!(addr & 1))) {
 		res = (uae_u32)mmu_get_word(addr, data, sz_long, rmw) << 16;
-		SAVE_EXCEPTION;
-		TRY(prb) {
-			res |= mmu_get_word(addr + 2, data, sz_long, rmw);
-			RESTORE_EXCEPTION;
-		}
-		CATCH(prb) {
-			RESTORE_EXCEPTION;
-			misalignednotfirst(addr);
-			THROW_AGAIN(prb);
-		} ENDTRY
+		mmu_split_begin(addr, 0, SPLIT_NOTFIRST);
+		res |= mmu_get_word(addr + 2, data, sz_long, rmw);
+		mmu_split_end();
 	} else {
 		res = (uae_u32)mmu_get_byte(addr, data, sz_long, rmw) << 8;
-		SAVE_EXCEPTION;
-		TRY(prb) {
-			res = (res | mmu_get_byte(addr + 1, data, sz_long, rmw)) << 8;
-			res = (res | mmu_get_byte(addr + 2, data, sz_long, rmw)) << 8;
-			res |= mmu_get_byte(addr + 3, data, sz_long, rmw);
-			RESTORE_EXCEPTION;
-		}
-		CATCH(prb) {
-			RESTORE_EXCEPTION;
-			misalignednotfirst(addr);
-			THROW_AGAIN(prb);
-		} ENDTRY
+		mmu_split_begin(addr, 0, SPLIT_NOTFIRST);
+		res = (res | mmu_get_byte(addr + 1, data, sz_long, rmw)) << 8;
+		res = (res | mmu_get_byte(addr + 2, data, sz_long, rmw)) << 8;
+		res |= mmu_get_byte(addr + 3, data, sz_long, rmw);
+		mmu_split_end();
 	}
 	return res;
 }
@@ -674,16 +715,9 @@ static uae_u16 REGPARAM2 mmu_get_lrmw_word_unaligned(uaecptr addr)
 	uae_u16 res;
 
 	res = (uae_u16)mmu_get_user_byte(addr, regs.s != 0, true, true, sz_word) << 8;
-	SAVE_EXCEPTION;
-	TRY(prb) {
-		res |= mmu_get_user_byte(addr + 1, regs.s != 0, true, true, sz_word);
-		RESTORE_EXCEPTION;
-	}
-	CATCH(prb) {
-		RESTORE_EXCEPTION;
-		misalignednotfirst(addr);
-		THROW_AGAIN(prb);
-	} ENDTRY
+	mmu_split_begin(addr, 0, SPLIT_NOTFIRST);
+	res |= mmu_get_user_byte(addr + 1, regs.s != 0, true, true, sz_word);
+	mmu_split_end();
 	return res;
 }
 
@@ -693,30 +727,16 @@ static uae_u32 REGPARAM2 mmu_get_lrmw_long_unaligned(uaecptr addr)
 
 	if (likely(!(addr & 1))) {
 		res = (uae_u32)mmu_get_user_word(addr, regs.s != 0, true, true, sz_long) << 16;
-		SAVE_EXCEPTION;
-		TRY(prb) {
-			res |= mmu_get_user_word(addr + 2, regs.s != 0, true, true, sz_long);
-			RESTORE_EXCEPTION;
-		}
-		CATCH(prb) {
-			RESTORE_EXCEPTION;
-			misalignednotfirst(addr);
-			THROW_AGAIN(prb);
-		} ENDTRY
+		mmu_split_begin(addr, 0, SPLIT_NOTFIRST);
+		res |= mmu_get_user_word(addr + 2, regs.s != 0, true, true, sz_long);
+		mmu_split_end();
 	} else {
 		res = (uae_u32)mmu_get_user_byte(addr, regs.s != 0, true, true, sz_long) << 8;
-		SAVE_EXCEPTION;
-		TRY(prb) {
-			res = (res | mmu_get_user_byte(addr + 1, regs.s != 0, true, true, sz_long)) << 8;
-			res = (res | mmu_get_user_byte(addr + 2, regs.s != 0, true, true, sz_long)) << 8;
-			res |= mmu_get_user_byte(addr + 3, regs.s != 0, true, true, sz_long);
-			RESTORE_EXCEPTION;
-		}
-		CATCH(prb) {
-			RESTORE_EXCEPTION;
-			misalignednotfirst(addr);
-			THROW_AGAIN(prb);
-		} ENDTRY
+		mmu_split_begin(addr, 0, SPLIT_NOTFIRST);
+		res = (res | mmu_get_user_byte(addr + 1, regs.s != 0, true, true, sz_long)) << 8;
+		res = (res | mmu_get_user_byte(addr + 2, regs.s != 0, true, true, sz_long)) << 8;
+		res |= mmu_get_user_byte(addr + 3, regs.s != 0, true, true, sz_long);
+		mmu_split_end();
 	}
 	return res;
 }
@@ -755,41 +775,25 @@ uae_u32 REGPARAM2 mmu_get_long_slow(uaecptr addr, bool super, bool data,
 
 void REGPARAM2 mmu_put_long_unaligned(uaecptr addr, uae_u32 val, bool data, bool rmw)
 {
-	SAVE_EXCEPTION;
-	TRY(prb) {
-		if (likely(!(addr & 1))) {
-			mmu_put_word(addr, val >> 16, data, sz_long, rmw);
-			mmu_put_word(addr + 2, val, data, sz_long, rmw);
-		} else {
-			mmu_put_byte(addr, val >> 24, data, sz_long, rmw);
-			mmu_put_byte(addr + 1, val >> 16, data, sz_long, rmw);
-			mmu_put_byte(addr + 2, val >> 8, data, sz_long, rmw);
-			mmu_put_byte(addr + 3, val, data, sz_long, rmw);
-		}
-		RESTORE_EXCEPTION;
+	mmu_split_begin(addr, val, SPLIT_WB3 | SPLIT_CHECK);
+	if (likely(!(addr & 1))) {
+		mmu_put_word(addr, val >> 16, data, sz_long, rmw);
+		mmu_put_word(addr + 2, val, data, sz_long, rmw);
+	} else {
+		mmu_put_byte(addr, val >> 24, data, sz_long, rmw);
+		mmu_put_byte(addr + 1, val >> 16, data, sz_long, rmw);
+		mmu_put_byte(addr + 2, val >> 8, data, sz_long, rmw);
+		mmu_put_byte(addr + 3, val, data, sz_long, rmw);
 	}
-	CATCH(prb) {
-		RESTORE_EXCEPTION;
-		regs.wb3_data = val;
-		misalignednotfirstcheck(addr);
-		THROW_AGAIN(prb);
-	} ENDTRY
+	mmu_split_end();
 }
 
 void REGPARAM2 mmu_put_word_unaligned(uaecptr addr, uae_u16 val, bool data, bool rmw)
 {
-	SAVE_EXCEPTION;
-	TRY(prb) {
-		mmu_put_byte(addr, val >> 8, data, sz_word, rmw);
-		mmu_put_byte(addr + 1, val, data, sz_word, rmw);
-		RESTORE_EXCEPTION;
-	}
-	CATCH(prb) {
-		RESTORE_EXCEPTION;
-		regs.wb3_data = val;
-		misalignednotfirstcheck(addr);
-		THROW_AGAIN(prb);
-	} ENDTRY
+	mmu_split_begin(addr, val, SPLIT_WB3 | SPLIT_CHECK);
+	mmu_put_byte(addr, val >> 8, data, sz_word, rmw);
+	mmu_put_byte(addr + 1, val, data, sz_word, rmw);
+	mmu_split_end();
 }
 
 void REGPARAM2 mmu_put_byte_slow(uaecptr addr, uae_u8 val, bool super, bool data,
@@ -840,30 +844,16 @@ uae_u32 REGPARAM2 sfc_get_long(uaecptr addr)
 	} else {
 		if (likely(!(addr & 1))) {
 			res = (uae_u32)mmu_get_user_word(addr, super, data, false, sz_long) << 16;
-			SAVE_EXCEPTION;
-			TRY(prb) {
-				res |= mmu_get_user_word(addr + 2, super, data, false, sz_long);
-				RESTORE_EXCEPTION;
-			}
-			CATCH(prb) {
-				RESTORE_EXCEPTION;
-				misalignednotfirst(addr);
-				THROW_AGAIN(prb);
-			} ENDTRY
+			mmu_split_begin(addr, 0, SPLIT_NOTFIRST);
+			res |= mmu_get_user_word(addr + 2, super, data, false, sz_long);
+			mmu_split_end();
 		} else {
 			res = (uae_u32)mmu_get_user_byte(addr, super, data, false, sz_long) << 8;
-			SAVE_EXCEPTION;
-			TRY(prb) {
-				res = (res | mmu_get_user_byte(addr + 1, super, data, false, sz_long)) << 8;
-				res = (res | mmu_get_user_byte(addr + 2, super, data, false, sz_long)) << 8;
-				res |= mmu_get_user_byte(addr + 3, super, data, false, sz_long);
-				RESTORE_EXCEPTION;
-			}
-			CATCH(prb) {
-				RESTORE_EXCEPTION;
-				misalignednotfirst(addr);
-				THROW_AGAIN(prb);
-			} ENDTRY
+			mmu_split_begin(addr, 0, SPLIT_NOTFIRST);
+			res = (res | mmu_get_user_byte(addr + 1, super, data, false, sz_long)) << 8;
+			res = (res | mmu_get_user_byte(addr + 2, super, data, false, sz_long)) << 8;
+			res |= mmu_get_user_byte(addr + 3, super, data, false, sz_long);
+			mmu_split_end();
 		}
 	}
 
@@ -882,16 +872,9 @@ uae_u16 REGPARAM2 sfc_get_word(uaecptr addr)
 		res = mmu_get_user_word(addr, super, data, false, sz_word);
 	} else {
 		res = (uae_u16)mmu_get_user_byte(addr, super, data, false, sz_word) << 8;
-		SAVE_EXCEPTION;
-		TRY(prb) {
-			res |= mmu_get_user_byte(addr + 1, super, data, false, sz_word);
-			RESTORE_EXCEPTION;
-		}
-		CATCH(prb) {
-			RESTORE_EXCEPTION;
-			misalignednotfirst(addr);
-			THROW_AGAIN(prb);
-		} ENDTRY
+		mmu_split_begin(addr, 0, SPLIT_NOTFIRST);
+		res |= mmu_get_user_byte(addr + 1, super, data, false, sz_word);
+		mmu_split_end();
 	}
 	ismoves = false;
 	return res;
@@ -915,27 +898,19 @@ void REGPARAM2 dfc_put_long(uaecptr addr, uae_u32 val)
 	bool data = true;
 
 	ismoves = true;
-	SAVE_EXCEPTION;
-	TRY(prb) {
-		if (likely(!is_unaligned(addr, 4)))
-			mmu_put_user_long(addr, val, super, data, sz_long);
-		else if (likely(!(addr & 1))) {
-			mmu_put_user_word(addr, val >> 16, super, data, sz_long);
-			mmu_put_user_word(addr + 2, val, super, data, sz_long);
-		} else {
-			mmu_put_user_byte(addr, val >> 24, super, data, sz_long);
-			mmu_put_user_byte(addr + 1, val >> 16, super, data, sz_long);
-			mmu_put_user_byte(addr + 2, val >> 8, super, data, sz_long);
-			mmu_put_user_byte(addr + 3, val, super, data, sz_long);
-		}
-		RESTORE_EXCEPTION;
+	mmu_split_begin(addr, val, SPLIT_WB3 | SPLIT_CHECK);
+	if (likely(!is_unaligned(addr, 4)))
+		mmu_put_user_long(addr, val, super, data, sz_long);
+	else if (likely(!(addr & 1))) {
+		mmu_put_user_word(addr, val >> 16, super, data, sz_long);
+		mmu_put_user_word(addr + 2, val, super, data, sz_long);
+	} else {
+		mmu_put_user_byte(addr, val >> 24, super, data, sz_long);
+		mmu_put_user_byte(addr + 1, val >> 16, super, data, sz_long);
+		mmu_put_user_byte(addr + 2, val >> 8, super, data, sz_long);
+		mmu_put_user_byte(addr + 3, val, super, data, sz_long);
 	}
-	CATCH(prb) {
-		RESTORE_EXCEPTION;
-		regs.wb3_data = val;
-		misalignednotfirstcheck(addr);
-		THROW_AGAIN(prb);
-	} ENDTRY
+	mmu_split_end();
 	ismoves = false;
 }
 
@@ -945,22 +920,14 @@ void REGPARAM2 dfc_put_word(uaecptr addr, uae_u16 val)
 	bool data = true;
 
 	ismoves = true;
-	SAVE_EXCEPTION;
-	TRY(prb) {
-		if (likely(!is_unaligned(addr, 2)))
-			mmu_put_user_word(addr, val, super, data, sz_word);
-		else {
-			mmu_put_user_byte(addr, val >> 8, super, data, sz_word);
-			mmu_put_user_byte(addr + 1, val, super, data, sz_word);
-		}
-		RESTORE_EXCEPTION;
+	mmu_split_begin(addr, val, SPLIT_WB3 | SPLIT_CHECK);
+	if (likely(!is_unaligned(addr, 2)))
+		mmu_put_user_word(addr, val, super, data, sz_word);
+	else {
+		mmu_put_user_byte(addr, val >> 8, super, data, sz_word);
+		mmu_put_user_byte(addr + 1, val, super, data, sz_word);
 	}
-	CATCH(prb) {
-		RESTORE_EXCEPTION;
-		regs.wb3_data = val;
-		misalignednotfirstcheck(addr);
-		THROW_AGAIN(prb);
-	} ENDTRY
+	mmu_split_end();
 	ismoves = false;
 }
 
@@ -970,31 +937,34 @@ void REGPARAM2 dfc_put_byte(uaecptr addr, uae_u8 val)
 	bool data = true;
 
 	ismoves = true;
-	SAVE_EXCEPTION;
-	TRY(prb) {
-		mmu_put_user_byte(addr, val, super, data, sz_byte);
-		RESTORE_EXCEPTION;
-	}
-	CATCH(prb) {
-		RESTORE_EXCEPTION;
-		regs.wb3_data = val;
-		THROW_AGAIN(prb);
-	} ENDTRY
+	mmu_split_begin(addr, val, SPLIT_WB3);
+	mmu_put_user_byte(addr, val, super, data, sz_byte);
+	mmu_split_end();
 	ismoves = false;
 }
 
 void mmu_get_move16(uaecptr addr, uae_u32 *v, bool data, int size)
 {
 	struct mmu_atc_line *cl;
+	struct mmu_tlb_entry *t;
 	addr &= ~15;
+	/* Previous: a line never crosses a page, translate it only once */
+	t = mmu_tlb_lookup(addr, data);
+	if (t && t->host) {
+		uae_u8 *p = t->host + (addr & mmu_pagemask);
+		for (int i = 0; i < 4; i++)
+			v[i] = do_get_ram_long(p + i * 4);
+		return;
+	}
 	for (int i = 0; i < 4; i++) {
 		uaecptr addr2 = addr + i * 4;
 		//                                       addr,super,data
 		if ((!regs.mmu_enabled) || (mmu_match_ttr(addr2,regs.s != 0,data,false)!=TTR_NO_MATCH))
 			v[i] = phys_get_long(addr2);
-		else if (likely(mmu_lookup(addr2, data, false, &cl)))
+		else if (likely(mmu_lookup(addr2, data, false, &cl))) {
+			mmu_tlb_fill(addr2, data, cl);
 			v[i] = phys_get_long(mmu_get_real_address(addr2, cl));
-		else
+		} else
 			v[i] = mmu_get_long_slow(addr2, regs.s != 0, data, size, false, cl);
 	}
 }
@@ -1002,15 +972,24 @@ void mmu_get_move16(uaecptr addr, uae_u32 *v, bool data, int size)
 void mmu_put_move16(uaecptr addr, uae_u32 *val, bool data, int size)
 {
 	struct mmu_atc_line *cl;
+	struct mmu_tlb_entry *t;
 	addr &= ~15;
+	t = mmu_tlb_lookup(addr, data);
+	if (t && t->writable && t->host) {
+		uae_u8 *p = t->host + (addr & mmu_pagemask);
+		for (int i = 0; i < 4; i++)
+			do_put_ram_long(p + i * 4, val[i]);
+		return;
+	}
 	for (int i = 0; i < 4; i++) {
 		uaecptr addr2 = addr + i * 4;
 		//                                        addr,super,data
 		if ((!regs.mmu_enabled) || (mmu_match_ttr_write(addr2,regs.s != 0,data,val[i],size,false)==TTR_OK_MATCH))
 			phys_put_long(addr2,val[i]);
-		else if (likely(mmu_lookup(addr2, data, true, &cl)))
+		else if (likely(mmu_lookup(addr2, data, true, &cl))) {
+			mmu_tlb_fill(addr2, data, cl);
 			phys_put_long(mmu_get_real_address(addr2, cl), val[i]);
-		else
+		} else
 			mmu_put_long_slow(addr2, val[i], regs.s != 0, data, size, false, cl);
 	}
 }
@@ -1144,6 +1123,7 @@ void REGPARAM2 mmu_flush_atc_all(bool global)
 void REGPARAM2 mmu_reset(void)
 {
 	mmu_flush_atc_all(true);
+	mmu_flush_tlb();
 }
 
 
@@ -1157,6 +1137,7 @@ void REGPARAM2 mmu_set_tc(uae_u16 tc)
 	regs.mmu_page_size = mmu_pagesize_8k ? 8192 : 4096;
 
 	mmu_flush_atc_all(true);
+	mmu_flush_tlb();
 
 	write_log(_T("%d MMU: enabled=%d page8k=%d\n"), currprefs.mmu_model, regs.mmu_enabled, mmu_pagesize_8k);
 }
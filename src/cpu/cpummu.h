@@ -172,6 +172,7 @@ struct mmu_atc_line {
 	unsigned modified : 1;
 	unsigned write_protect : 1;
 	uaecptr phys; // phys base address
+	uae_u32 gen;  // changes whenever the line is filled
 };
 
 /*
@@ -347,6 +348,7 @@ void mmu_make_transparent_region(uaecptr baseaddr, uae_u32 size, int datamode);
 
 uaecptr REGPARAM3 mmu_translate(uaecptr addr, bool super, bool data, bool write) REGPARAM;
 void mmu_bus_error(uaecptr addr, int fc, bool write, int size, bool rmw, uae_u32 status, bool nonmmu);
+void mmu_split_clear(void);
 
 uae_u32 REGPARAM3 sfc_get_long(uaecptr addr) REGPARAM;
 uae_u16 REGPARAM3 sfc_get_word(uaecptr addr) REGPARAM;
@@ -391,87 +393,212 @@ static ALWAYS_INLINE uaecptr mmu_get_real_address(uaecptr addr, struct mmu_atc_l
     return cl->phys | (addr & mmu_pagemask);
 }
 
+/*
+ * Previous: translation cache in front of the ATC. It maps a logical page
+ * to the host memory (or physical address) of the page, separately for
+ * user/supervisor and data/instruction accesses. An entry is only used
+ * while the ATC line it was filled from still holds the same translation,
+ * so PFLUSH and ATC replacement invalidate it. TC and TT register writes
+ * and resets flush it, because TT and enable bit are checked before it.
+ */
+#define MMU_TLB_SLOTS 256
+
+struct mmu_tlb_entry {
+	uaecptr page;
+	struct mmu_atc_line *line;
+	uae_u32 tag;
+	uae_u32 gen;
+	bool writable;
+	uaecptr phys;
+	uae_u8 *host;  // host memory of the page or NULL
+};
+
+extern struct mmu_tlb_entry mmu_tlb[2][ATC_TYPE][MMU_TLB_SLOTS];
+
+void mmu_flush_tlb(void);
+
+static ALWAYS_INLINE struct mmu_tlb_entry *mmu_tlb_entry(uaecptr addr, bool data)
+{
+	return &mmu_tlb[mmu_is_super ? 1 : 0][data][(addr >> 12) & (MMU_TLB_SLOTS - 1)];
+}
+
+static ALWAYS_INLINE struct mmu_tlb_entry *mmu_tlb_lookup(uaecptr addr, bool data)
+{
+	struct mmu_tlb_entry *t = mmu_tlb_entry(addr, data);
+
+	if (t->page == (addr & ~mmu_pagemask) && t->gen &&
+		t->line->gen == t->gen && t->line->valid && t->line->tag == t->tag)
+		return t;
+	return NULL;
+}
+
+static ALWAYS_INLINE void mmu_tlb_fill(uaecptr addr, bool data, struct mmu_atc_line *cl)
+{
+	struct mmu_tlb_entry *t = mmu_tlb_entry(addr, data);
+	addrbank *ab = &get_mem_bank(cl->phys);
+
+	t->page     = addr & ~mmu_pagemask;
+	t->line     = cl;
+	t->tag      = cl->tag;
+	t->gen      = cl->gen;
+	t->writable = cl->modified && !cl->write_protect;
+	t->phys     = cl->phys;
+	t->host     = ab->baseaddr ? ab->baseaddr + (cl->phys & ab->mask) : NULL;
+}
+
+/* Host memory of the len bytes at addr for MOVEM, or NULL unless they are
+ * all in one RAM page the translation cache already allows the access for.
+ * Nothing can fault then, so the caller may move them in one go. */
+static ALWAYS_INLINE uae_u8 *mmu_get_host_range(uaecptr addr, int len, bool write)
+{
+	struct mmu_tlb_entry *t;
+
+	if ((addr ^ (addr + len - 1)) & ~mmu_pagemask)
+		return NULL;
+	t = mmu_tlb_lookup(addr, true);
+	if (!t || !t->host || (write && !t->writable))
+		return NULL;
+	return t->host + (addr & mmu_pagemask);
+}
+
 void mmu_get_move16(uaecptr addr, uae_u32 *v, bool data, int size);
 void mmu_put_move16(uaecptr addr, uae_u32 *val, bool data, int size);
 
 static ALWAYS_INLINE uae_u32 mmu_get_long(uaecptr addr, bool data, int size, bool rmw)
 {
 	struct mmu_atc_line *cl;
+	struct mmu_tlb_entry *t = mmu_tlb_lookup(addr, data);
+
+	if (t) {
+		if (t->host)
+			return do_get_ram_long(t->host + (addr & mmu_pagemask));
+		return phys_get_long(t->phys | (addr & mmu_pagemask));
+	}
 
 	//                                       addr,super,data
 	if ((!regs.mmu_enabled) || (mmu_match_ttr(addr,regs.s != 0,data,rmw)!=TTR_NO_MATCH))
 		return phys_get_long(addr);
-	if (likely(mmu_lookup(addr, data, false, &cl)))
+	if (likely(mmu_lookup(addr, data, false, &cl))) {
+		mmu_tlb_fill(addr, data, cl);
 		return phys_get_long(mmu_get_real_address(addr, cl));
+	}
 	return mmu_get_long_slow(addr, regs.s != 0, data, size, rmw, cl);
 }
 
 static ALWAYS_INLINE uae_u16 mmu_get_word(uaecptr addr, bool data, int size, bool rmw)
 {
 	struct mmu_atc_line *cl;
+	struct mmu_tlb_entry *t = mmu_tlb_lookup(addr, data);
+
+	if (t) {
+		if (t->host)
+			return do_get_ram_word(t->host + (addr & mmu_pagemask));
+		return phys_get_word(t->phys | (addr & mmu_pagemask));
+	}
 
 	//                                       addr,super,data
 	if ((!regs.mmu_enabled) || (mmu_match_ttr(addr,regs.s != 0,data,rmw)!=TTR_NO_MATCH))
 		return phys_get_word(addr);
-	if (likely(mmu_lookup(addr, data, false, &cl)))
+	if (likely(mmu_lookup(addr, data, false, &cl))) {
+		mmu_tlb_fill(addr, data, cl);
 		return phys_get_word(mmu_get_real_address(addr, cl));
+	}
 	return mmu_get_word_slow(addr, regs.s != 0, data, size, rmw, cl);
 }
 
 static ALWAYS_INLINE uae_u8 mmu_get_byte(uaecptr addr, bool data, int size, bool rmw)
 {
 	struct mmu_atc_line *cl;
+	struct mmu_tlb_entry *t = mmu_tlb_lookup(addr, data);
+
+	if (t) {
+		if (t->host)
+			return do_get_ram_byte(t->host + (addr & mmu_pagemask));
+		return phys_get_byte(t->phys | (addr & mmu_pagemask));
+	}
 
 	//                                       addr,super,data
 	if ((!regs.mmu_enabled) || (mmu_match_ttr(addr,regs.s != 0,data,rmw)!=TTR_NO_MATCH))
 		return phys_get_byte(addr);
-	if (likely(mmu_lookup(addr, data, false, &cl)))
+	if (likely(mmu_lookup(addr, data, false, &cl))) {
+		mmu_tlb_fill(addr, data, cl);
 		return phys_get_byte(mmu_get_real_address(addr, cl));
+	}
 	return mmu_get_byte_slow(addr, regs.s != 0, data, size, rmw, cl);
 }
 
 static ALWAYS_INLINE void mmu_put_long(uaecptr addr, uae_u32 val, bool data, int size, bool rmw)
 {
 	struct mmu_atc_line *cl;
+	struct mmu_tlb_entry *t = mmu_tlb_lookup(addr, data);
+
+	if (t && t->writable) {
+		if (t->host)
+			do_put_ram_long(t->host + (addr & mmu_pagemask), val);
+		else
+			phys_put_long(t->phys | (addr & mmu_pagemask), val);
+		return;
+	}
 
 	//                                        addr,super,data
 	if ((!regs.mmu_enabled) || mmu_match_ttr_write(addr,regs.s != 0,data,val,size,rmw)==TTR_OK_MATCH) {
 		phys_put_long(addr,val);
 		return;
 	}
-	if (likely(mmu_lookup(addr, data, true, &cl)))
+	if (likely(mmu_lookup(addr, data, true, &cl))) {
+		mmu_tlb_fill(addr, data, cl);
 		phys_put_long(mmu_get_real_address(addr, cl), val);
-	else
+	} else
 		mmu_put_long_slow(addr, val, regs.s != 0, data, size, rmw, cl);
 }
 
 static ALWAYS_INLINE void mmu_put_word(uaecptr addr, uae_u16 val, bool data, int size, bool rmw)
 {
 	struct mmu_atc_line *cl;
+	struct mmu_tlb_entry *t = mmu_tlb_lookup(addr, data);
+
+	if (t && t->writable) {
+		if (t->host)
+			do_put_ram_word(t->host + (addr & mmu_pagemask), val);
+		else
+			phys_put_word(t->phys | (addr & mmu_pagemask), val);
+		return;
+	}
 
 	//                                        addr,super,data
 	if ((!regs.mmu_enabled) || (mmu_match_ttr_write(addr,regs.s != 0,data,val,size,rmw)==TTR_OK_MATCH)) {
 		phys_put_word(addr,val);
 		return;
 	}
-	if (likely(mmu_lookup(addr, data, true, &cl)))
+	if (likely(mmu_lookup(addr, data, true, &cl))) {
+		mmu_tlb_fill(addr, data, cl);
 		phys_put_word(mmu_get_real_address(addr, cl), val);
-	else
+	} else
 		mmu_put_word_slow(addr, val, regs.s != 0, data, size, rmw, cl);
 }
 
 static ALWAYS_INLINE void mmu_put_byte(uaecptr addr, uae_u8 val, bool data, int size, bool rmw)
 {
 	struct mmu_atc_line *cl;
+	struct mmu_tlb_entry *t = mmu_tlb_lookup(addr, data);
+
+	if (t && t->writable) {
+		if (t->host)
+			do_put_ram_byte(t->host + (addr & mmu_pagemask), val);
+		else
+			phys_put_byte(t->phys | (addr & mmu_pagemask), val);
+		return;
+	}
 
 	//                                        addr,super,data
 	if ((!regs.mmu_enabled) || (mmu_match_ttr_write(addr,regs.s != 0,data,val,size,rmw)==TTR_OK_MATCH)) {
 		phys_put_byte(addr,val);
 		return;
 	}
-	if (likely(mmu_lookup(addr, data, true, &cl)))
+	if (likely(mmu_lookup(addr, data, true, &cl))) {
+		mmu_tlb_fill(addr, data, cl);
 		phys_put_byte(mmu_get_real_address(addr, cl), val);
-	else
+	} else
 		mmu_put_byte_slow(addr, val, regs.s != 0, data, size, rmw, cl);
 }
 
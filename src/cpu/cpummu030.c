@@ -54,6 +54,8 @@
 
 static int bBusErrorReadWrite;
 static int atcindextable[32];
+static uae_u32 mmu030_atc_gen;
+MMU030_IFETCH mmu030_ifetch;
 static int tt_enabled;
 
 int mmu030_idx;
@@ -94,6 +96,8 @@ typedef struct {
     } logical;
     /* history bit */
     int mru;
+    /* changes whenever the line gets a new translation */
+    uae_u32 gen;
 } MMU030_ATC_LINE;
 
 
@@ -282,6 +286,9 @@ void mmu_op30_pmove (uaecptr pc, uae_u32 opcode, uae_u16 next, uaecptr extra)
         mmu030_flush_atc_all();
     }
 	tt_enabled = (tt0_030 & TT_ENABLE) || (tt1_030 & TT_ENABLE);
+    /* TT registers and the TC enable bit are checked before the TLB */
+    if (!rw)
+        mmu030_flush_tlb();
 }
 
 void mmu_op30_ptest (uaecptr pc, uae_u32 opcode, uae_u16 next, uaecptr extra)
@@ -429,6 +436,7 @@ void mmu030_flush_atc_fc(uae_u32 fc_base, uae_u32 fc_mask) {
 #endif
 		}
     }
+    mmu030_flush_ifetch();
 }
 
 /* This function flushes ATC entries depending on their logical address
@@ -446,6 +454,7 @@ void mmu030_flush_atc_page_fc(uaecptr logical_addr, uae_u32 fc_base, uae_u32 fc_
 #endif
 		}
     }
+    mmu030_flush_ifetch();
 }
 
 /* This function flushes ATC entries depending on their logical address */
@@ -461,6 +470,7 @@ void mmu030_flush_atc_page(uaecptr logical_addr) {
 #endif
 		}
     }
+    mmu030_flush_ifetch();
 }
 
 /* This function flushes all ATC entries */
@@ -472,6 +482,7 @@ void mmu030_flush_atc_all(void) {
     for (i=0; i<ATC030_NUM_ENTRIES; i++) {
         mmu030.atc[i].logical.valid = false;
     }
+    mmu030_flush_tlb();
 }
 
 
@@ -710,6 +721,10 @@ int mmu030_do_match_lrmw_ttr(uae_u32 tt, TT_info comp, uaecptr addr, uae_u32 fc)
 
 void mmu030_decode_tc(uae_u32 TC) {
         
+    /* Let m68k_go() switch between the run loops */
+    if (mmu030.enabled != ((TC & TC_ENABLE_TRANSLATION) != 0))
+        set_special(SPCFLAG_MODE_CHANGE);
+
     /* Set MMU condition */    
     if (TC & TC_ENABLE_TRANSLATION) {
         mmu030.enabled = true;
@@ -1453,6 +1468,8 @@ uae_u32 mmu030_table_search(uaecptr addr, uae_u32 fc, bool write, int level) {
     mmu030_atc_handle_history_bit(i);
     
     /* Create ATC entry */
+    mmu030_flush_ifetch();
+    mmu030.atc[i].gen = ++mmu030_atc_gen;
     mmu030.atc[i].logical.addr = addr & mmu030.translation.page.imask; /* delete page index bits */
     mmu030.atc[i].logical.fc = fc;
     mmu030.atc[i].logical.valid = true;
@@ -1780,6 +1797,7 @@ int mmu030_logical_is_in_atc(uaecptr addr, uae_u32 fc, bool write) {
                 return index;
             } else {
                 mmu030.atc[index].logical.valid = false;
+                mmu030_flush_ifetch();
             }
 		}
 		index++;
@@ -1801,6 +1819,8 @@ void mmu030_atc_handle_history_bit(int entry_num) {
         for (j=0; j<ATC030_NUM_ENTRIES; j++) {
             mmu030.atc[j].mru = 0;
         }
+        /* Fetches from mmu030_ifetch do not set the history bit */
+        mmu030_flush_ifetch();
         mmu030.atc[entry_num].mru = 1;
 #if MMU030_ATC_DBG_MSG
         write_log(_T("ATC: No more history zero-bits. Reset all.\n"));
@@ -1809,6 +1829,124 @@ void mmu030_atc_handle_history_bit(int entry_num) {
 }
 
 
+/* Software TLB in front of the ATC. It maps a logical page and function
+ * code directly to the ATC line holding its translation and to the host
+ * memory of the physical page. An entry is only used while its ATC line is
+ * valid and still holds the same translation, so PFLUSH, TC/CRP/SRP writes
+ * and ATC replacements invalidate it implicitly. TT registers and the TC
+ * enable bit are checked before the TLB, so PMOVE and reset flush it.
+ * Reads and writes use separate tables, because a TT register may only
+ * match one direction.
+ */
+#define TLB030_NUM_ENTRIES 256
+
+typedef struct {
+    uaecptr logical;
+    uae_u32 fc;
+    int line;
+    uae_u32 gen;
+    uaecptr physical;
+    uae_u8 *host;   /* host memory of the physical page or NULL */
+} MMU030_TLB_ENTRY;
+
+static MMU030_TLB_ENTRY mmu030_tlb[2][TLB030_NUM_ENTRIES];
+
+void mmu030_flush_tlb(void) {
+    int i;
+    mmu030_flush_ifetch();
+    for (i=0; i<TLB030_NUM_ENTRIES; i++) {
+        mmu030_tlb[0][i].gen = 0;
+        mmu030_tlb[1][i].gen = 0;
+    }
+}
+
+static ALWAYS_INLINE MMU030_TLB_ENTRY *mmu030_tlb_entry(uaecptr maddr, uae_u32 fc, bool write) {
+    int index = ((maddr >> mmu030.translation.page.size) ^ fc) & (TLB030_NUM_ENTRIES - 1);
+    return &mmu030_tlb[write ? 1 : 0][index];
+}
+
+static ALWAYS_INLINE MMU030_TLB_ENTRY *mmu030_tlb_lookup(uaecptr addr, uae_u32 fc, bool write) {
+    uaecptr maddr = addr & mmu030.translation.page.imask;
+    MMU030_TLB_ENTRY *t = mmu030_tlb_entry(maddr, fc, write);
+    
+    if (t->logical == maddr && t->fc == fc && t->gen &&
+        t->gen == mmu030.atc[t->line].gen && mmu030.atc[t->line].logical.valid) {
+        /* Maintain history bit */
+        if (!mmu030.atc[t->line].mru)
+            mmu030_atc_handle_history_bit(t->line);
+        return t;
+    }
+    return NULL;
+}
+
+/* Remember the translation of ATC line l if it allows the access
+ * without a fault. */
+static void mmu030_tlb_fill(uaecptr addr, uae_u32 fc, bool write, int l) {
+    MMU030_TLB_ENTRY *t;
+    addrbank *ab;
+    
+    if (l < 0 || mmu030.atc[l].physical.bus_error)
+        return;
+    if (write && (mmu030.atc[l].physical.write_protect || !mmu030.atc[l].physical.modified))
+        return;
+    
+    t = mmu030_tlb_entry(addr & mmu030.translation.page.imask, fc, write);
+    t->logical  = addr & mmu030.translation.page.imask;
+    t->fc       = fc;
+    t->line     = l;
+    t->gen      = mmu030.atc[l].gen;
+    t->physical = mmu030.atc[l].physical.addr & mmu030.translation.page.imask;
+    ab = &get_mem_bank(t->physical);
+    t->host     = ab->baseaddr ? ab->baseaddr + (t->physical & ab->mask) : NULL;
+}
+
+/* Pages without translation use a 4K granule of the bank base pointer */
+#define UNTRANSLATED030_IMASK 0xFFFFF000
+
+/* Remember the page of an instruction fetch that just succeeded. */
+
+static void mmu030_ifetch_fill(uaecptr addr, uae_u32 fc) {
+    MMU030_TLB_ENTRY *t;
+    addrbank *ab;
+    
+    if ((!mmu030.enabled) || (mmu030_match_ttr_access(addr,fc,false))) {
+        ab = &get_mem_bank(addr);
+        if (!ab->baseaddr)
+            return;
+        mmu030_ifetch.imask = UNTRANSLATED030_IMASK;
+        mmu030_ifetch.page  = addr & UNTRANSLATED030_IMASK;
+        mmu030_ifetch.host  = ab->baseaddr + (mmu030_ifetch.page & ab->mask);
+    } else {
+        t = mmu030_tlb_lookup(addr, fc, false);
+        if (!t || !t->host)
+            return;
+        mmu030_ifetch.imask = mmu030.translation.page.imask;
+        mmu030_ifetch.page  = t->logical;
+        mmu030_ifetch.host  = t->host;
+    }
+    mmu030_ifetch.fc = fc;
+}
+
+/* Host memory of the len bytes at addr for MOVEM, or NULL unless they are
+ * all in one RAM page that can be accessed without a fault. */
+uae_u8 *mmu030_get_host_range(uaecptr addr, int len, uae_u32 fc, bool write) {
+    MMU030_TLB_ENTRY *t;
+    addrbank *ab;
+    
+    if ((!mmu030.enabled) || (mmu030_match_ttr_access(addr,fc,write))) {
+        if ((addr ^ (addr + len - 1)) & UNTRANSLATED030_IMASK)
+            return NULL;
+        ab = &get_mem_bank(addr);
+        return ab->baseaddr ? ab->baseaddr + (addr & ab->mask) : NULL;
+    }
+    if ((addr ^ (addr + len - 1)) & mmu030.translation.page.imask)
+        return NULL;
+    t = mmu030_tlb_lookup(addr, fc, write);
+    if (!t || !t->host)
+        return NULL;
+    return t->host + (addr & mmu030.translation.page.mask);
+}
+
 /* Memory access functions:
  * If the address matches one of the transparent translation registers
  * use it directly as physical address, else check ATC for the
@@ -1817,6 +1955,14 @@ void mmu030_atc_handle_history_bit(int entry_num) {
  */
 
 void mmu030_put_long(uaecptr addr, uae_u32 val, uae_u32 fc) {
+    MMU030_TLB_ENTRY *t = mmu030_tlb_lookup(addr, fc, true);
+    if (t) {
+        if (t->host)
+            do_put_ram_long(t->host + (addr & mmu030.translation.page.mask), val);
+        else
+            phys_put_long(t->physical + (addr & mmu030.translation.page.mask), val);
+        return;
+    }
     
 	//                                        addr,super,write
 	if ((!mmu030.enabled) || (mmu030_match_ttr_access(addr,fc,true)) || (fc==7)) {
@@ -1826,15 +1972,23 @@ void mmu030_put_long(uaecptr addr, uae_u32 val, uae_u32 fc) {
 
     int atc_line_num = mmu030_logical_is_in_atc(addr, fc, true);
 
-    if (atc_line_num>=0) {
-        mmu030_put_long_atc(addr, val, atc_line_num, fc);
-    } else {
-        mmu030_table_search(addr,fc,true,0);
-        mmu030_put_long_atc(addr, val, mmu030_logical_is_in_atc(addr,fc,true), fc);
+    if (atc_line_num<0) {
+        mmu030_table_search(addr, fc, true, 0);
+        atc_line_num = mmu030_logical_is_in_atc(addr, fc, true);
     }
+    mmu030_tlb_fill(addr, fc, true, atc_line_num);
+    mmu030_put_long_atc(addr, val, atc_line_num, fc);
 }
 
 void mmu030_put_word(uaecptr addr, uae_u16 val, uae_u32 fc) {
+    MMU030_TLB_ENTRY *t = mmu030_tlb_lookup(addr, fc, true);
+    if (t) {
+        if (t->host)
+            do_put_ram_word(t->host + (addr & mmu030.translation.page.mask), val);
+        else
+            phys_put_word(t->physical + (addr & mmu030.translation.page.mask), val);
+        return;
+    }
     
 	//                                        addr,super,write
 	if ((!mmu030.enabled) || (mmu030_match_ttr_access(addr,fc,true)) || (fc==7)) {
@@ -1844,15 +1998,23 @@ void mmu030_put_word(uaecptr addr, uae_u16 val, uae_u32 fc) {
     
     int atc_line_num = mmu030_logical_is_in_atc(addr, fc, true);
     
-    if (atc_line_num>=0) {
-        mmu030_put_word_atc(addr, val, atc_line_num, fc);
-    } else {
+    if (atc_line_num<0) {
         mmu030_table_search(addr, fc, true, 0);
-        mmu030_put_word_atc(addr, val, mmu030_logical_is_in_atc(addr,fc,true), fc);
+        atc_line_num = mmu030_logical_is_in_atc(addr, fc, true);
     }
+    mmu030_tlb_fill(addr, fc, true, atc_line_num);
+    mmu030_put_word_atc(addr, val, atc_line_num, fc);
 }
 
 void mmu030_put_byte(uaecptr addr, uae_u8 val, uae_u32 fc) {
+    MMU030_TLB_ENTRY *t = mmu030_tlb_lookup(addr, fc, true);
+    if (t) {
+        if (t->host)
+            do_put_ram_byte(t->host + (addr & mmu030.translation.page.mask), val);
+        else
+            phys_put_byte(t->physical + (addr & mmu030.translation.page.mask), val);
+        return;
+    }
     
 	//                                        addr,super,write
 	if ((!mmu030.enabled) || (mmu030_match_ttr_access(addr, fc, true)) || (fc==7)) {
@@ -1862,15 +2024,21 @@ void mmu030_put_byte(uaecptr addr, uae_u8 val, uae_u32 fc) {
     
     int atc_line_num = mmu030_logical_is_in_atc(addr, fc, true);
 
-    if (atc_line_num>=0) {
-        mmu030_put_byte_atc(addr, val, atc_line_num, fc);
-    } else {
+    if (atc_line_num<0) {
         mmu030_table_search(addr, fc, true, 0);
-        mmu030_put_byte_atc(addr, val, mmu030_logical_is_in_atc(addr,fc,true), fc);
+        atc_line_num = mmu030_logical_is_in_atc(addr, fc, true);
     }
+    mmu030_tlb_fill(addr, fc, true, atc_line_num);
+    mmu030_put_byte_atc(addr, val, atc_line_num, fc);
 }
 
 uae_u32 mmu030_get_long(uaecptr addr, uae_u32 fc) {
+    MMU030_TLB_ENTRY *t = mmu030_tlb_lookup(addr, fc, false);
+    if (t) {
+        if (t->host)
+            return do_get_ram_long(t->host + (addr & mmu030.translation.page.mask));
+        return phys_get_long(t->physical + (addr & mmu030.translation.page.mask));
+    }
     
 	//                                        addr,super,write
 	if ((!mmu030.enabled) || (mmu030_match_ttr_access(addr,fc,false)) || (fc==7)) {
@@ -1879,15 +2047,21 @@ uae_u32 mmu030_get_long(uaecptr addr, uae_u32 fc) {
     
     int atc_line_num = mmu030_logical_is_in_atc(addr, fc, false);
 
-    if (atc_line_num>=0) {
-        return mmu030_get_long_atc(addr, atc_line_num, fc);
-    } else {
+    if (atc_line_num<0) {
         mmu030_table_search(addr, fc, false, 0);
-        return mmu030_get_long_atc(addr, mmu030_logical_is_in_atc(addr,fc,false), fc);
+        atc_line_num = mmu030_logical_is_in_atc(addr, fc, false);
     }
+    mmu030_tlb_fill(addr, fc, false, atc_line_num);
+    return mmu030_get_long_atc(addr, atc_line_num, fc);
 }
 
 uae_u16 mmu030_get_word(uaecptr addr, uae_u32 fc) {
+    MMU030_TLB_ENTRY *t = mmu030_tlb_lookup(addr, fc, false);
+    if (t) {
+        if (t->host)
+            return do_get_ram_word(t->host + (addr & mmu030.translation.page.mask));
+        return phys_get_word(t->physical + (addr & mmu030.translation.page.mask));
+    }
     
 	//                                        addr,super,write
 	if ((!mmu030.enabled) || (mmu030_match_ttr_access(addr,fc,false)) || (fc==7)) {
@@ -1896,15 +2070,21 @@ uae_u16 mmu030_get_word(uaecptr addr, uae_u32 fc) {
     
     int atc_line_num = mmu030_logical_is_in_atc(addr, fc, false);
 
-    if (atc_line_num>=0) {
-        return mmu030_get_word_atc(addr, atc_line_num, fc);
-    } else {
+    if (atc_line_num<0) {
         mmu030_table_search(addr, fc, false, 0);
-        return mmu030_get_word_atc(addr, mmu030_logical_is_in_atc(addr,fc,false), fc);
+        atc_line_num = mmu030_logical_is_in_atc(addr, fc, false);
     }
+    mmu030_tlb_fill(addr, fc, false, atc_line_num);
+    return mmu030_get_word_atc(addr, atc_line_num, fc);
 }
 
 uae_u8 mmu030_get_byte(uaecptr addr, uae_u32 fc) {
+    MMU030_TLB_ENTRY *t = mmu030_tlb_lookup(addr, fc, false);
+    if (t) {
+        if (t->host)
+            return do_get_ram_byte(t->host + (addr & mmu030.translation.page.mask));
+        return phys_get_byte(t->physical + (addr & mmu030.translation.page.mask));
+    }
     
 	//                                        addr,super,write
 	if ((!mmu030.enabled) || (mmu030_match_ttr_access(addr,fc,false)) || (fc==7)) {
@@ -1913,12 +2093,24 @@ uae_u8 mmu030_get_byte(uaecptr addr, uae_u32 fc) {
     
     int atc_line_num = mmu030_logical_is_in_atc(addr, fc, false);
 
-    if (atc_line_num>=0) {
-        return mmu030_get_byte_atc(addr, atc_line_num, fc);
-    } else {
+    if (atc_line_num<0) {
         mmu030_table_search(addr, fc, false, 0);
-        return mmu030_get_byte_atc(addr, mmu030_logical_is_in_atc(addr,fc,false), fc);
+        atc_line_num = mmu030_logical_is_in_atc(addr, fc, false);
     }
+    mmu030_tlb_fill(addr, fc, false, atc_line_num);
+    return mmu030_get_byte_atc(addr, atc_line_num, fc);
+}
+
+uae_u32 mmu030_get_ilong(uaecptr addr, uae_u32 fc) {
+    uae_u32 v = mmu030_get_long(addr, fc);
+    mmu030_ifetch_fill(addr, fc);
+    return v;
+}
+
+uae_u16 mmu030_get_iword(uaecptr addr, uae_u32 fc) {
+    uae_u16 v = mmu030_get_word(addr, fc);
+    mmu030_ifetch_fill(addr, fc);
+    return v;
 }
 
 
@@ -2041,15 +2233,7 @@ uae_u16 REGPARAM2 mmu030_get_word_unaligned(uaecptr addr, uae_u32 fc, int flags)
 	uae_u16 res;
     
 	res = (uae_u16)mmu030_get_generic(addr, fc, sz_byte, sz_word, flags) << 8;
-	SAVE_EXCEPTION;
-	TRY(prb) {
-		res |= mmu030_get_generic(addr + 1, fc, sz_byte, sz_word, flags);
-		RESTORE_EXCEPTION;
-	}
-	CATCH(prb) {
-		RESTORE_EXCEPTION;
-		THROW_AGAIN(prb);
-	} ENDTRY
+	res |= mmu030_get_generic(addr + 1, fc, sz_byte, sz_word, flags);
 	return res;
 }
 
@@ -2059,28 +2243,12 @@ uae_u32 REGPARAM2 mmu030_get_long_unaligned(uaecptr addr, uae_u32 fc, int flags)
     
 	if (likely(!(addr & 1))) {
 		res = (uae_u32)mmu030_get_generic(addr, fc, sz_word, sz_long, flags) << 16;
-		SAVE_EXCEPTION;
-		TRY(prb) {
-			res |= mmu030_get_generic(addr + 2, fc, sz_word, sz_long, flags);
-			RESTORE_EXCEPTION;
-		}
-		CATCH(prb) {
-			RESTORE_EXCEPTION;
-			THROW_AGAIN(prb);
-		} ENDTRY
+		res |= mmu030_get_generic(addr + 2, fc, sz_word, sz_long, flags);
 	} else {
 		res = (uae_u32)mmu030_get_generic(addr, fc, sz_byte, sz_long, flags) << 8;
-		SAVE_EXCEPTION;
-		TRY(prb) {
-			res = (res | mmu030_get_generic(addr + 1, fc, sz_byte, sz_long, flags)) << 8;
-			res = (res | mmu030_get_generic(addr + 2, fc, sz_byte, sz_long, flags)) << 8;
-			res |= mmu030_get_generic(addr + 3, fc, sz_byte, sz_long, flags);
-			RESTORE_EXCEPTION;
-		}
-		CATCH(prb) {
-			RESTORE_EXCEPTION;
-			THROW_AGAIN(prb);
-		} ENDTRY
+		res = (res | mmu030_get_generic(addr + 1, fc, sz_byte, sz_long, flags)) << 8;
+		res = (res | mmu030_get_generic(addr + 2, fc, sz_byte, sz_long, flags)) << 8;
+		res |= mmu030_get_generic(addr + 3, fc, sz_byte, sz_long, flags);
 	}
 	return res;
 }
@@ -2088,39 +2256,25 @@ uae_u32 REGPARAM2 mmu030_get_long_unaligned(uaecptr addr, uae_u32 fc, int flags)
 
 void REGPARAM2 mmu030_put_long_unaligned(uaecptr addr, uae_u32 val, uae_u32 fc, int flags)
 {
-	SAVE_EXCEPTION;
-	TRY(prb) {
-		if (likely(!(addr & 1))) {
-			mmu030_put_generic(addr, val >> 16, fc, sz_word, sz_long, flags);
-			mmu030_put_generic(addr + 2, val, fc, sz_word, sz_long, flags);
-		} else {
-			mmu030_put_generic(addr, val >> 24, fc, sz_byte, sz_long, flags);
-			mmu030_put_generic(addr + 1, val >> 16, fc, sz_byte, sz_long, flags);
-			mmu030_put_generic(addr + 2, val >> 8, fc, sz_byte, sz_long, flags);
-			mmu030_put_generic(addr + 3, val, fc, sz_byte, sz_long, flags);
-		}
-		RESTORE_EXCEPTION;
+	/* Only used if one of the accesses faults */
+	regs.wb3_data = val;
+	if (likely(!(addr & 1))) {
+		mmu030_put_generic(addr, val >> 16, fc, sz_word, sz_long, flags);
+		mmu030_put_generic(addr + 2, val, fc, sz_word, sz_long, flags);
+	} else {
+		mmu030_put_generic(addr, val >> 24, fc, sz_byte, sz_long, flags);
+		mmu030_put_generic(addr + 1, val >> 16, fc, sz_byte, sz_long, flags);
+		mmu030_put_generic(addr + 2, val >> 8, fc, sz_byte, sz_long, flags);
+		mmu030_put_generic(addr + 3, val, fc, sz_byte, sz_long, flags);
 	}
-	CATCH(prb) {
-		RESTORE_EXCEPTION;
-		regs.wb3_data = val;
-		THROW_AGAIN(prb);
-	} ENDTRY
 }
 
 void REGPARAM2 mmu030_put_word_unaligned(uaecptr addr, uae_u16 val, uae_u32 fc, int flags)
 {
-	SAVE_EXCEPTION;
-	TRY(prb) {
-		mmu030_put_generic(addr, val >> 8, fc, sz_byte, sz_word, flags);
-		mmu030_put_generic(addr + 1, val, fc, sz_byte, sz_word, flags);
-		RESTORE_EXCEPTION;
-	}
-	CATCH(prb) {
-		RESTORE_EXCEPTION;
-		regs.wb3_data = val;
-		THROW_AGAIN(prb);
-	} ENDTRY
+	/* Only used if one of the accesses faults */
+	regs.wb3_data = val;
+	mmu030_put_generic(addr, val >> 8, fc, sz_byte, sz_word, flags);
+	mmu030_put_generic(addr + 1, val, fc, sz_byte, sz_word, flags);
 }
 
 
@@ -2155,15 +2309,23 @@ uaecptr mmu030_translate(uaecptr addr, bool super, bool data, bool write)
     }
 }
 
+bool mmu030_translation_enabled(void)
+{
+    return mmu030.enabled;
+}
+
 /* MMU Reset */
 void mmu030_reset(int hardreset)
 {
     /* A CPU reset causes the E-bits of TC and TT registers to be zeroed. */
+    if (mmu030.enabled)
+        set_special(SPCFLAG_MODE_CHANGE);
     mmu030.enabled = false;
 	regs.mmu_page_size = 0;
 	tc_030 &= ~TC_ENABLE_TRANSLATION;
 	tt0_030 &= ~TT_ENABLE;
 	tt1_030 &= ~TT_ENABLE;
+	mmu030_flush_tlb();
 	if (hardreset) {
 		srp_030 = crp_030 = 0;
 		tt0_030 = tt1_030 = tc_030 = 0;
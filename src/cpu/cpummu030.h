@@ -69,7 +69,27 @@ void mmu030_flush_atc_fc(uae_u32 fc_base, uae_u32 fc_mask);
 void mmu030_flush_atc_page(uaecptr logical_addr);
 void mmu030_flush_atc_page_fc(uaecptr logical_addr, uae_u32 fc_base, uae_u32 fc_mask);
 void mmu030_flush_atc_all(void);
+void mmu030_flush_tlb(void);
+
+/* Previous: code page of the last instruction fetch. Opcode and extension
+ * word fetches inside it read host memory directly. Filled by
+ * mmu030_get_iword/ilong() for RAM pages and cleared whenever the ATC, the
+ * TT registers or TC change. fc is 0 while it is empty. */
+typedef struct {
+    uaecptr page;
+    uaecptr imask;
+    uae_u32 fc;
+    uae_u8 *host;   /* host memory of the page */
+} MMU030_IFETCH;
+
+extern MMU030_IFETCH mmu030_ifetch;
+
+static ALWAYS_INLINE void mmu030_flush_ifetch(void)
+{
+    mmu030_ifetch.fc = 0;
+}
 void mmu030_reset(int hardreset);
+bool mmu030_translation_enabled(void);
 uaecptr mmu030_translate(uaecptr addr, bool super, bool data, bool write);
 
 int mmu030_match_ttr(uaecptr addr, uae_u32 fc, bool write);
@@ -84,6 +104,9 @@ void mmu030_put_byte(uaecptr addr, uae_u8  val, uae_u32 fc);
 uae_u32 mmu030_get_long(uaecptr addr, uae_u32 fc);
 uae_u16 mmu030_get_word(uaecptr addr, uae_u32 fc);
 uae_u8  mmu030_get_byte(uaecptr addr, uae_u32 fc);
+uae_u32 mmu030_get_ilong(uaecptr addr, uae_u32 fc);
+uae_u16 mmu030_get_iword(uaecptr addr, uae_u32 fc);
+uae_u8 *mmu030_get_host_range(uaecptr addr, int len, uae_u32 fc, bool write);
 
 uae_u32 uae_mmu030_get_lrmw(uaecptr addr, int size);
 void uae_mmu030_put_lrmw(uaecptr addr, uae_u32 val, int size);
@@ -101,17 +124,24 @@ static ALWAYS_INLINE uae_u32 uae_mmu030_get_ilong(uaecptr addr)
 {
     uae_u32 fc = (regs.s ? 4 : 0) | 2;
 
+	if (likely(fc == mmu030_ifetch.fc &&
+	           (addr & (mmu030_ifetch.imask | 1)) == mmu030_ifetch.page &&
+	           ((addr + 2) & mmu030_ifetch.imask) == mmu030_ifetch.page))
+		return do_get_ram_long(mmu030_ifetch.host + (addr & ~mmu030_ifetch.imask));
 	if (unlikely(is_unaligned(addr, 4)))
 		return mmu030_get_long_unaligned(addr, fc, 0);
-	return mmu030_get_long(addr, fc);
+	return mmu030_get_ilong(addr, fc);
 }
 static ALWAYS_INLINE uae_u16 uae_mmu030_get_iword(uaecptr addr)
 {
     uae_u32 fc = (regs.s ? 4 : 0) | 2;
 
+	if (likely(fc == mmu030_ifetch.fc &&
+	           (addr & (mmu030_ifetch.imask | 1)) == mmu030_ifetch.page))
+		return do_get_ram_word(mmu030_ifetch.host + (addr & ~mmu030_ifetch.imask));
 	if (unlikely(is_unaligned(addr, 2)))
 		return mmu030_get_word_unaligned(addr, fc, 0);
-	return mmu030_get_word(addr, fc);
+	return mmu030_get_iword(addr, fc);
 }
 static ALWAYS_INLINE uae_u16 uae_mmu030_get_ibyte(uaecptr addr)
 {
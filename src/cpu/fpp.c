@@ -1889,6 +1889,76 @@ static void fround (int reg)
 	regs.fp[reg].fp = (float)regs.fp[reg].fp;
 }
 
+/* Previous: FADD, FSUB, FMUL, FDIV and FSQRT in host double precision if
+ * FPCR or the opcode selects single or double rounding precision. Used if
+ * the compatible FPU is switched off. The 6888x keeps the extended exponent
+ * range in these modes, so operands that are no exact doubles and results
+ * that are not normal numbers are left to the long double code. In single
+ * precision the operands also have to be exact floats: only then does
+ * rounding to double first give the same float as rounding once. */
+static bool fpu_op_double (int reg, uae_u16 extra, fptype src)
+{
+	double a = (double)regs.fp[reg].fp;
+	double b = (double)src;
+	double r;
+	int prec;
+	bool unary;
+
+	if (extra & 0x40)
+		prec = (extra & 0x04) ? 2 : 1;
+	else
+		prec = (regs.fpcr >> 6) & 3;
+	if (prec != 1 && prec != 2)
+		return false;
+	/* FSQRT does not read the destination */
+	unary = (extra & 0x7f) == 0x04 || (extra & 0x7f) == 0x41 || (extra & 0x7f) == 0x45;
+	if ((fptype)b != src || (!unary && (fptype)a != regs.fp[reg].fp))
+		return false;
+	if (prec == 1 && ((float)b != b || (!unary && (float)a != a)))
+		return false;
+
+	switch (extra & 0x7f)
+	{
+		case 0x04: /* FSQRT */
+		case 0x41: /* FSSQRT */
+		case 0x45: /* FDSQRT */
+			r = sqrt (b);
+			break;
+		case 0x20: /* FDIV */
+		case 0x60: /* FSDIV */
+		case 0x64: /* FDDIV */
+			r = a / b;
+			break;
+		case 0x22: /* FADD */
+		case 0x62: /* FSADD */
+		case 0x66: /* FDADD */
+			r = a + b;
+			break;
+		case 0x23: /* FMUL */
+		case 0x63: /* FSMUL */
+		case 0x67: /* FDMUL */
+			r = a * b;
+			break;
+		case 0x28: /* FSUB */
+		case 0x68: /* FSSUB */
+		case 0x6c: /* FDSUB */
+			r = a - b;
+			break;
+		default:
+			return false;
+	}
+	if (prec == 1) {
+		float f = (float)r;
+		if (!isnormal (f))
+			return false;
+		r = f;
+	} else if (!isnormal (r)) {
+		return false;
+	}
+	regs.fp[reg].fp = r;
+	return true;
+}
+
 static uaecptr fmovem2mem (uaecptr ad, uae_u32 list, int incr, int regdir)
 {
 	int reg;
@@ -2273,6 +2343,10 @@ static void fpuop_arithmetic2 (uae_u32 opcode, uae_u16 extra)
 			regs.fpiar =  pc;
 
 			CLEAR_STATUS ();
+			if (!currprefs.fpu_strict && fpu_op_double (reg, extra, src)) {
+				MAKE_FPSR (&regs.fp[reg].fp);
+				return;
+			}
 			sgl = false;
 			switch (extra & 0x7f)
 			{
@@ -31,6 +31,7 @@
 
 static FILE *headerfile;
 static FILE *stblfile;
+static FILE *thrfile;
 
 static int using_prefetch, using_indirect, using_mmu;
 static int using_prefetch_020, using_ce020;
@@ -71,6 +72,9 @@ static int *opcode_map;
 static int *opcode_next_clev;
 static int *opcode_last_postfix;
 static unsigned long *counts;
+#define MAX_FUSED 64
+static int fused_map[MAX_FUSED][2];
+static int nr_fused;
 static int generate_stbl;
 static int mmufixupcnt;
 static int mmufixupstate;
@@ -187,6 +191,44 @@ static void read_counts (void)
 		term ();
 }
 
+/* Hot instruction pairs that get a fused handler. Each line of the file
+* holds the two opcodes in hex, any register form of an opcode stands for
+* its merged handler. Lines starting with # are comments.  */
+static void read_fused (const char *name)
+{
+	FILE *file;
+	char line[200];
+	unsigned int first, second;
+	int i;
+
+	nr_fused = 0;
+	file = fopen (name, "r");
+	if (!file)
+		return;
+	while (fgets (line, sizeof line, file)) {
+		if (line[0] == '#' || sscanf (line, "%x %x", &first, &second) != 2)
+			continue;
+		if (first > 0xffff || second > 0xffff || nr_fused == MAX_FUSED)
+			term_1 ("bad fused pair");
+		if (table68k[first].handler != -1)
+			first = table68k[first].handler;
+		if (table68k[second].handler != -1)
+			second = table68k[second].handler;
+		if (table68k[first].mnemo == i_ILLG || table68k[second].mnemo == i_ILLG)
+			continue;
+		for (i = 0; i < nr_fused; i++) {
+			if (fused_map[i][0] == first && fused_map[i][1] == second)
+				break;
+		}
+		if (i < nr_fused)
+			continue;
+		fused_map[nr_fused][0] = first;
+		fused_map[nr_fused][1] = second;
+		nr_fused++;
+	}
+	fclose (file);
+}
+
 static char endlabelstr[80];
 static int endlabelno = 0;
 static int need_endlabel;
@@ -1935,7 +1977,8 @@ static bool mmu040_special_movem (uae_u16 opcode)
 //	return (((((opcode >> 3) & 7) == 7) && ((opcode & 7) == 2 || (opcode & 7) == 3)) || ((opcode >> 3) & 7) == 6);
 }
 
-static void movem_mmu040 (const char *code, int size, bool put, bool aipi, bool apdi, uae_u16 opcode)
+/* Register loops of a MOVEM without the MMU bookkeeping */
+static void movem_loops (const char *code, int size, bool put, bool apdi)
 {
 	const char *index;
 	int dphase;
@@ -1949,9 +1992,6 @@ static void movem_mmu040 (const char *code, int size, bool put, bool aipi, bool
 		index = "movem_index1";
 	}
 
-	printf ("\tmmu040_movem = 1;\n");
-	printf ("\tmmu040_movem_ea = srca;\n");
-
 	for (i = 0; i < 2; i++) {
 		char reg;
 		if (i == dphase)
@@ -1971,6 +2011,30 @@ static void movem_mmu040 (const char *code, int size, bool put, bool aipi, bool
 		printf ("\t\t%cmask = movem_next[%cmask];\n", reg, reg);
 		printf ("\t}\n");
 	}
+}
+
+/* Previous: movem_base and movem_len describe the memory a MOVEM accesses.
+* If it is all in one RAM page that can be accessed without a fault, the
+* host memory of the page is used directly (fastcode instead of code). */
+static void movem_range (int size, bool apdi)
+{
+	printf ("\tint movem_len = (movem_count[dmask] + movem_count[amask]) * %d;\n", size);
+	printf ("\tuaecptr movem_base = srca%s;\n", apdi ? " - movem_len" : "");
+	printf ("\tuae_u8 *movem_host = NULL;\n");
+}
+
+static void movem_mmu040 (const char *code, const char *fastcode, int size, bool put, bool aipi, bool apdi, uae_u16 opcode)
+{
+	printf ("\tmmu040_movem = 1;\n");
+	printf ("\tmmu040_movem_ea = srca;\n");
+
+	movem_range (size, apdi);
+	printf ("\tmovem_host = mmu_get_host_range (movem_base, movem_len, %s);\n", put ? "true" : "false");
+	printf ("\tif (movem_host) {\n");
+	movem_loops (fastcode, size, put, apdi);
+	printf ("\t} else {\n");
+	movem_loops (code, size, put, apdi);
+	printf ("\t}\n");
 	if (aipi || apdi)
 		printf ("\tm68k_areg (regs, dstreg) = srca;\n");
 	printf ("\tmmu040_movem = 0;\n");
@@ -1979,7 +2043,7 @@ static void movem_mmu040 (const char *code, int size, bool put, bool aipi, bool
 /* 68030 MMU does not restore register state if it bus faults.
  * (also there wouldn't be enough space in stack frame to store all registers)
  */
-static void movem_mmu030 (const char *code, int size, bool put, bool aipi, bool apdi)
+static void movem_mmu030 (const char *code, const char *fastcode, int size, bool put, bool aipi, bool apdi)
 {
 	const char *index;
 	int i;
@@ -2000,6 +2064,12 @@ static void movem_mmu030 (const char *code, int size, bool put, bool aipi, bool
 		printf ("\telse\n");
 		printf ("\t\tmmu030_ad[mmu030_idx].val = srca;\n");
 	}
+	movem_range (size, apdi);
+	printf ("\tif (mmu030_state[0] == 0 && !(mmu030_state[1] & MMU030_STATEFLAG1_MOVEM2))\n");
+	printf ("\t\tmovem_host = mmu030_get_host_range (movem_base, movem_len, (regs.s ? 4 : 0) | 1, %s);\n", put ? "true" : "false");
+	printf ("\tif (movem_host) {\n");
+	movem_loops (fastcode, size, put, apdi);
+	printf ("\t} else {\n");
 	for (i = 0; i < 2; i++) {
 		char reg;
 		if (i == dphase)
@@ -2031,19 +2101,22 @@ static void movem_mmu030 (const char *code, int size, bool put, bool aipi, bool
 		printf ("\t\t%cmask = movem_next[%cmask];\n", reg, reg);
 		printf ("\t}\n");
 	}
+	printf ("\t}\n");
 	if (aipi || apdi)
 		printf ("\tm68k_areg (regs, dstreg) = srca;\n");
 }
 
 static void genmovemel (uae_u16 opcode)
 {
-	char getcode[100];
+	char getcode[100], fastcode[100];
 	int size = table68k[opcode].size == sz_long ? 4 : 2;
 
 	if (table68k[opcode].size == sz_long) {
 		sprintf (getcode, "%s (srca)", srcld);
+		sprintf (fastcode, "do_get_ram_long (movem_host + (srca - movem_base))");
 	} else {
 		sprintf (getcode, "(uae_s32)(uae_s16)%s (srca)", srcwd);
+		sprintf (fastcode, "(uae_s32)(uae_s16)do_get_ram_word (movem_host + (srca - movem_base))");
 	}
 	count_read += table68k[opcode].size == sz_long ? 2 : 1;
 	printf ("\tuae_u16 mask = %s;\n", gen_nextiword (0));
@@ -2052,11 +2125,11 @@ static void genmovemel (uae_u16 opcode)
 	addcycles_ce020_1 (8 - 2);
 	start_brace ();
 	if (using_mmu == 68030) {
-		movem_mmu030 (getcode, size, false, table68k[opcode].dmode == Aipi, false);
+		movem_mmu030 (getcode, fastcode, size, false, table68k[opcode].dmode == Aipi, false);
 	} else if (using_mmu == 68060) {
 		movem_mmu060 (getcode, size, false, table68k[opcode].dmode == Aipi, false);
 	} else if (using_mmu == 68040) {
-		movem_mmu040 (getcode, size, false, table68k[opcode].dmode == Aipi, false, opcode);
+		movem_mmu040 (getcode, fastcode, size, false, table68k[opcode].dmode == Aipi, false, opcode);
 	} else {
 		printf ("\twhile (dmask) {\n");
 		printf ("\t\tm68k_dreg (regs, movem_index1[dmask]) = %s; srca += %d; dmask = movem_next[dmask];\n", getcode, size);
@@ -2107,13 +2180,15 @@ static void genmovemel_ce (uae_u16 opcode)
 
 static void genmovemle (uae_u16 opcode)
 {
-	char putcode[100];
+	char putcode[100], fastcode[100];
 	int size = table68k[opcode].size == sz_long ? 4 : 2;
 
 	if (table68k[opcode].size == sz_long) {
 		sprintf (putcode, "%s (srca", dstld);
+		sprintf (fastcode, "do_put_ram_long (movem_host + (srca - movem_base)");
 	} else {
 		sprintf (putcode, "%s (srca", dstwd);
+		sprintf (fastcode, "do_put_ram_word (movem_host + (srca - movem_base)");
 	}
 	count_write += table68k[opcode].size == sz_long ? 2 : 1;
 
@@ -2127,11 +2202,11 @@ static void genmovemle (uae_u16 opcode)
 		else
 			printf ("\tuae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;\n");
 		if (using_mmu == 68030)
-			movem_mmu030 (putcode, size, true, false, table68k[opcode].dmode == Apdi);
+			movem_mmu030 (putcode, fastcode, size, true, false, table68k[opcode].dmode == Apdi);
 		else if (using_mmu == 68060)
 			movem_mmu060 (putcode, size, true, false, table68k[opcode].dmode == Apdi);
 		else if (using_mmu == 68040)
-			movem_mmu040 (putcode, size, true, false, table68k[opcode].dmode == Apdi, opcode);
+			movem_mmu040 (putcode, fastcode, size, true, false, table68k[opcode].dmode == Apdi, opcode);
 	} else {
 		if (table68k[opcode].dmode == Apdi) {
 			printf ("\tuae_u16 amask = mask & 0xff, dmask = (mask >> 8) & 0xff;\n");
@@ -2315,9 +2390,7 @@ static void genflags_normal (flagtypes type, wordsizes size, const char *value,
 
 	switch (type) {
 	case flag_logical:
-		printf ("\tCLEAR_CZNV ();\n");
-		printf ("\tSET_ZFLG (%s == 0);\n", vstr);
-		printf ("\tSET_NFLG (%s < 0);\n", vstr);
+		printf ("\tSET_LOGICAL_NZ (%s);\n", vstr);
 		break;
 	case flag_logical_noclobber:
 		printf ("\tSET_ZFLG (%s == 0);\n", vstr);
@@ -2337,6 +2410,7 @@ static void genflags_normal (flagtypes type, wordsizes size, const char *value,
 		printf ("\tSET_NFLG (%s < 0);\n", vstr);
 		break;
 	case flag_add:
+		printf ("\tCLEAR_LAZY_FLAGS ();\n");
 		printf ("\tSET_ZFLG (%s == 0);\n", vstr);
 		printf ("\tSET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));\n");
 		printf ("\tSET_CFLG (%s < %s);\n", undstr, usstr);
@@ -2344,6 +2418,7 @@ static void genflags_normal (flagtypes type, wordsizes size, const char *value,
 		printf ("\tSET_NFLG (flgn != 0);\n");
 		break;
 	case flag_sub:
+		printf ("\tCLEAR_LAZY_FLAGS ();\n");
 		printf ("\tSET_ZFLG (%s == 0);\n", vstr);
 		printf ("\tSET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));\n");
 		printf ("\tSET_CFLG (%s > %s);\n", usstr, udstr);
@@ -2361,6 +2436,7 @@ static void genflags_normal (flagtypes type, wordsizes size, const char *value,
 		duplicate_carry (0);
 		break;
 	case flag_cmp:
+		printf ("\tCLEAR_LAZY_FLAGS ();\n");
 		printf ("\tSET_ZFLG (%s == 0);\n", vstr);
 		printf ("\tSET_VFLG ((flgs != flgo) && (flgn != flgo));\n");
 		printf ("\tSET_CFLG (%s > %s);\n", usstr, udstr);
@@ -5250,6 +5326,7 @@ static void generate_one_opcode (int rp, const char *extra)
 		(using_ce || using_ce020) ? "cpuop_func_ce" : "cpuop_func", opcode, postfix, extra);
 	fprintf (headerfile, "extern %s op_%04lx_%d%s_ff;\n",
 		(using_ce || using_ce020) ? "cpuop_func_ce" : "cpuop_func", opcode, postfix, extra);
+	fprintf (thrfile, "THREAD_OP_%d (op_%04lx_%d%s_ff)\n", postfix, opcode, postfix, extra);
 	printf ("/* %s */\n", outopcode (opcode));
 	if (i68000)
 		printf("#ifndef CPUEMU_68000_ONLY\n");
@@ -5392,6 +5469,36 @@ static void generate_func (const char *extra)
 		fprintf (stblfile, "{ 0, 0 }};\n");
 }
 
+/* Fused handlers run the second instruction of a hot pair right after the
+* first one if m68k_fuse_next() says the run loop has nothing to do in
+* between. Only the 68040 run loop uses them.  */
+static void generate_fused (const char *extra)
+{
+	int i, first, second;
+
+	printf ("#ifdef PART_8\n");
+	for (i = 0; i < nr_fused; i++) {
+		first = fused_map[i][0];
+		second = fused_map[i][1];
+		if (table68k[first].clev > cpu_level || table68k[second].clev > cpu_level)
+			continue;
+		fprintf (headerfile, "extern cpuop_func op_%04x_%04x_%d%s_nf;\n", first, second, postfix, extra);
+		fprintf (headerfile, "extern cpuop_func op_%04x_%04x_%d%s_ff;\n", first, second, postfix, extra);
+		printf ("/* %s ; ", outopcode (first));
+		printf ("%s */\n", outopcode (second));
+		printf ("uae_u32 REGPARAM2 CPUFUNC(op_%04x_%04x_%d%s)(uae_u32 opcode)\n{\n", first, second, postfix, extra);
+		printf ("\tuae_u32 cycles = CPUFUNC(op_%04x_%d%s)(opcode);\n", first, postfix, extra);
+		printf ("\tif (!m68k_fuse_next (&opcode, cycles))\n");
+		printf ("\t\treturn cycles;\n");
+		printf ("\treturn CPUFUNC(op_%04x_%d%s)(opcode);\n", second, postfix, extra);
+		printf ("}\n\n");
+		if (generate_stbl)
+			fprintf (stblfile, "{ CPUFUNC(op_%04x_%04x_%d%s), 0x%04x, 0x%04x },\n",
+				first, second, postfix, extra, first, second);
+	}
+	printf ("#endif\n\n");
+}
+
 static void generate_cpu (int id, int mode)
 {
 	char fname[100];
@@ -5506,6 +5613,13 @@ static void generate_cpu (int id, int mode)
 	}
 	endlabelno = id * 10000;
 	generate_func (extra);
+	if (using_mmu == 68040) {
+		if (generate_stbl)
+			fprintf (stblfile, "const struct cpufused CPUFUNC(op_fusedtbl_%d%s)[] = {\n", postfix, extra);
+		generate_fused (extra);
+		if (generate_stbl)
+			fprintf (stblfile, "{ 0, 0, 0 }};\n");
+	}
 	if (generate_stbl) {
 		if ((id > 0 && id < 10) || (id >= 20))
 			fprintf (stblfile, "#endif /* CPUEMU_68000_ONLY */\n");
@@ -5527,6 +5641,8 @@ int main (int argc, char **argv)
 	opcode_next_clev = xmalloc (int, nr_cpuop_funcs);
 	counts = xmalloc (unsigned long, 65536);
 	read_counts ();
+	if (argc > 1)
+		read_fused (argv[1]);
 
 	/* It would be a lot nicer to put all in one file (we'd also get rid of
 	* cputbl.h that way), but cpuopti can't cope.  That could be fixed, but
@@ -5537,6 +5653,10 @@ int main (int argc, char **argv)
 	stblfile = fopen ("cpustbl.c", "wb");
 	generate_includes (stblfile, 0);
 
+	/* One THREAD_OP_<postfix> line per handler for the threaded dispatcher
+	* in newcpu.c, which defines the macros before including the file. */
+	thrfile = fopen ("cputhr.h", "wb");
+
 	using_prefetch = 0;
 	using_indirect = 0;
 	using_exception_3 = 1;
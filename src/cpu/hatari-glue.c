@@ -34,8 +34,8 @@ struct uae_prefs currprefs, changed_prefs;
  * due to the interrupt level field in the SR.
  */
 int intlev(void) {
-    /* Poll interrupt level from interrupt status and mask registers
-     * --> see sysReg.c
+    /* Interrupt level is kept up to date by the interrupt status
+     * and mask registers --> see sysReg.c
      */
     return get_interrupt_level();
 }
@@ -13,6 +13,10 @@
 struct flag_struct {
     unsigned int cznv;
     unsigned int x;
+#ifdef ENABLE_LAZY_FLAGS
+    int nzres;          /* sign extended result of the last logical op */
+    unsigned int lazy;  /* cznv still has to be computed from nzres */
+#endif
 };
 
 extern struct flag_struct regflags;
@@ -43,6 +47,47 @@ extern struct flag_struct regflags;
 #define FLAGVAL_V	(1 << FLAGBIT_V)
 #define FLAGVAL_X	(1 << FLAGBIT_X)
 
+#ifdef ENABLE_LAZY_FLAGS
+
+/*
+ * Previous: lazy flags. Logical operations (MOVE, TST, AND, OR, ...) only
+ * record their result with SET_LOGICAL_NZ; cznv is computed from it when
+ * a flag is read or partially updated. Instructions that set all of CZNV
+ * call CLEAR_LAZY_FLAGS first, so the compiler can drop the checks in
+ * the SET_xFLG macros that follow.
+ */
+STATIC_INLINE void flags_materialize (void)
+{
+    if (regflags.lazy) {
+	regflags.cznv = ((regflags.nzres == 0) << FLAGBIT_Z) | ((regflags.nzres < 0) << FLAGBIT_N);
+	regflags.lazy = 0;
+    }
+}
+
+#define SET_ZFLG(y)	(flags_materialize (), regflags.cznv = (regflags.cznv & ~FLAGVAL_Z) | (((y) ? 1 : 0) << FLAGBIT_Z))
+#define SET_CFLG(y)	(flags_materialize (), regflags.cznv = (regflags.cznv & ~FLAGVAL_C) | (((y) ? 1 : 0) << FLAGBIT_C))
+#define SET_VFLG(y)	(flags_materialize (), regflags.cznv = (regflags.cznv & ~FLAGVAL_V) | (((y) ? 1 : 0) << FLAGBIT_V))
+#define SET_NFLG(y)	(flags_materialize (), regflags.cznv = (regflags.cznv & ~FLAGVAL_N) | (((y) ? 1 : 0) << FLAGBIT_N))
+#define SET_XFLG(y)	(regflags.x    = ((y) ? 1 : 0) << FLAGBIT_X)
+
+#define GET_ZFLG()	(flags_materialize (), (regflags.cznv >> FLAGBIT_Z) & 1)
+#define GET_CFLG()	(flags_materialize (), (regflags.cznv >> FLAGBIT_C) & 1)
+#define GET_VFLG()	(flags_materialize (), (regflags.cznv >> FLAGBIT_V) & 1)
+#define GET_NFLG()	(flags_materialize (), (regflags.cznv >> FLAGBIT_N) & 1)
+#define GET_XFLG()	((regflags.x    >> FLAGBIT_X) & 1)
+
+#define CLEAR_CZNV()	(regflags.lazy = 0, regflags.cznv  = 0)
+#define GET_CZNV()	(flags_materialize (), regflags.cznv)
+#define IOR_CZNV(X)	(flags_materialize (), regflags.cznv |= (X))
+#define SET_CZNV(X)	(regflags.lazy = 0, regflags.cznv  = (X))
+
+#define COPY_CARRY() (flags_materialize (), regflags.x = regflags.cznv)
+
+#define SET_LOGICAL_NZ(v)	(regflags.nzres = (v), regflags.lazy = 1)
+#define CLEAR_LAZY_FLAGS()	(regflags.lazy = 0)
+
+#else
+
 #define SET_ZFLG(y)	(regflags.cznv = (regflags.cznv & ~FLAGVAL_Z) | (((y) ? 1 : 0) << FLAGBIT_Z))
 #define SET_CFLG(y)	(regflags.cznv = (regflags.cznv & ~FLAGVAL_C) | (((y) ? 1 : 0) << FLAGBIT_C))
 #define SET_VFLG(y)	(regflags.cznv = (regflags.cznv & ~FLAGVAL_V) | (((y) ? 1 : 0) << FLAGBIT_V))
@@ -62,13 +107,47 @@ extern struct flag_struct regflags;
 
 #define COPY_CARRY() (regflags.x = regflags.cznv)
 
+/* C and V cleared, N and Z from the result */
+#define SET_LOGICAL_NZ(v)	SET_CZNV ((((v) == 0) << FLAGBIT_Z) | (((v) < 0) << FLAGBIT_N))
+#define CLEAR_LAZY_FLAGS()
+
+#endif /* ENABLE_LAZY_FLAGS */
+
 
 /*
  * Test CCR condition
  */
 STATIC_INLINE int cctrue (int cc)
 {
-    uae_u32 cznv = regflags.cznv;
+    uae_u32 cznv;
+
+#ifdef ENABLE_LAZY_FLAGS
+    if (regflags.lazy) {
+	/* C and V are clear after a logical operation */
+	int res = regflags.nzres;
+
+	switch (cc) {
+	case 0:  return 1;			/* T  */
+	case 1:  return 0;			/* F  */
+	case 2:  return res != 0;		/* HI */
+	case 3:  return res == 0;		/* LS */
+	case 4:  return 1;			/* CC */
+	case 5:  return 0;			/* CS */
+	case 6:  return res != 0;		/* NE */
+	case 7:  return res == 0;		/* EQ */
+	case 8:  return 1;			/* VC */
+	case 9:  return 0;			/* VS */
+	case 10: return res >= 0;		/* PL */
+	case 11: return res < 0;		/* MI */
+	case 12: return res >= 0;		/* GE */
+	case 13: return res < 0;		/* LT */
+	case 14: return res > 0;		/* GT */
+	case 15: return res <= 0;		/* LE */
+	}
+	return 0;
+    }
+#endif
+    cznv = regflags.cznv;
 
     switch (cc) {
 	case 0:  return 1;								/*				T  */
@@ -106,4 +106,69 @@ static inline void do_put_mem_byte(uae_u8 *a, uae_u8 v)
 }
 
 
+/* Previous: guest RAM. With ENABLE_HOST_ORDER_RAM (little endian hosts
+ * only) every aligned long of NEXTRam is stored in host byte order, so
+ * aligned long and word accesses are plain loads and stores. Words and
+ * bytes are found by flipping the low address bits, unaligned accesses
+ * are split. This relies on NEXTRam being declared long aligned. */
+#ifdef ENABLE_HOST_ORDER_RAM
+
+#include <stdint.h>
+
+static inline uae_u8 do_get_ram_byte(uae_u8 *a)
+{
+	return *(uae_u8 *)((uintptr_t)a ^ 3);
+}
+
+static inline void do_put_ram_byte(uae_u8 *a, uae_u8 v)
+{
+	*(uae_u8 *)((uintptr_t)a ^ 3) = v;
+}
+
+static inline uae_u16 do_get_ram_word(uae_u8 *a)
+{
+	if ((uintptr_t)a & 1)
+		return (do_get_ram_byte(a) << 8) | do_get_ram_byte(a + 1);
+	return *(uae_u16 *)((uintptr_t)a ^ 2);
+}
+
+static inline void do_put_ram_word(uae_u8 *a, uae_u16 v)
+{
+	if ((uintptr_t)a & 1) {
+		do_put_ram_byte(a, v >> 8);
+		do_put_ram_byte(a + 1, v);
+	} else {
+		*(uae_u16 *)((uintptr_t)a ^ 2) = v;
+	}
+}
+
+static inline uae_u32 do_get_ram_long(uae_u8 *a)
+{
+	if ((uintptr_t)a & 3)
+		return (do_get_ram_word(a) << 16) | do_get_ram_word(a + 2);
+	return *(uae_u32 *)a;
+}
+
+static inline void do_put_ram_long(uae_u8 *a, uae_u32 v)
+{
+	if ((uintptr_t)a & 3) {
+		do_put_ram_word(a, v >> 16);
+		do_put_ram_word(a + 2, v);
+	} else {
+		*(uae_u32 *)a = v;
+	}
+}
+
+#else
+
+#define do_get_ram_byte(a)    do_get_mem_byte(a)
+#define do_put_ram_byte(a, v) do_put_mem_byte(a, v)
+#define do_get_ram_word(a)    do_get_mem_word(a)
+#define do_put_ram_word(a, v) do_put_mem_word(a, v)
+#define do_get_ram_long(a)    do_get_mem_long(a)
+#define do_put_ram_long(a, v) do_put_mem_long(a, v)
+
+#endif
+
+
 #endif /* UAE_MACCESS_H */
@@ -353,148 +353,148 @@ static void mem_rom_bput(uaecptr addr, uae_u32 b)
 static uae_u32 mem_ram_bank0_lget(uaecptr addr)
 {
 	addr &= NEXT_ram_bank0_mask;
-	return do_get_mem_long(NEXTRam + addr);
+	return do_get_ram_long(NEXTRam + addr);
 }
 
 static uae_u32 mem_ram_bank0_wget(uaecptr addr)
 {
 	addr &= NEXT_ram_bank0_mask;
-	return do_get_mem_word(NEXTRam + addr);
+	return do_get_ram_word(NEXTRam + addr);
 }
 
 static uae_u32 mem_ram_bank0_bget(uaecptr addr)
 {
 	addr &= NEXT_ram_bank0_mask;
-	return NEXTRam[addr];
+	return do_get_ram_byte(NEXTRam + addr);
 }
 
 static void mem_ram_bank0_lput(uaecptr addr, uae_u32 l)
 {
 	addr &= NEXT_ram_bank0_mask;
-	do_put_mem_long(NEXTRam + addr, l);
+	do_put_ram_long(NEXTRam + addr, l);
 }
 
 static void mem_ram_bank0_wput(uaecptr addr, uae_u32 w)
 {
 	addr &= NEXT_ram_bank0_mask;
-	do_put_mem_word(NEXTRam + addr, w);
+	do_put_ram_word(NEXTRam + addr, w);
 }
 
 static void mem_ram_bank0_bput(uaecptr addr, uae_u32 b)
 {
 	addr &= NEXT_ram_bank0_mask;
-	NEXTRam[addr] = b;
+	do_put_ram_byte(NEXTRam + addr, b);
 }
 
 
 static uae_u32 mem_ram_bank1_lget(uaecptr addr)
 {
 	addr &= NEXT_ram_bank1_mask;
-	return do_get_mem_long(NEXTRam + addr);
+	return do_get_ram_long(NEXTRam + addr);
 }
 
 static uae_u32 mem_ram_bank1_wget(uaecptr addr)
 {
 	addr &= NEXT_ram_bank1_mask;
-	return do_get_mem_word(NEXTRam + addr);
+	return do_get_ram_word(NEXTRam + addr);
 }
 
 static uae_u32 mem_ram_bank1_bget(uaecptr addr)
 {
 	addr &= NEXT_ram_bank1_mask;
-	return NEXTRam[addr];
+	return do_get_ram_byte(NEXTRam + addr);
 }
 
 static void mem_ram_bank1_lput(uaecptr addr, uae_u32 l)
 {
 	addr &= NEXT_ram_bank1_mask;
-	do_put_mem_long(NEXTRam + addr, l);
+	do_put_ram_long(NEXTRam + addr, l);
 }
 
 static void mem_ram_bank1_wput(uaecptr addr, uae_u32 w)
 {
 	addr &= NEXT_ram_bank1_mask;
-	do_put_mem_word(NEXTRam + addr, w);
+	do_put_ram_word(NEXTRam + addr, w);
 }
 
 static void mem_ram_bank1_bput(uaecptr addr, uae_u32 b)
 {
 	addr &= NEXT_ram_bank1_mask;
-	NEXTRam[addr] = b;
+	do_put_ram_byte(NEXTRam + addr, b);
 }
 
 
 static uae_u32 mem_ram_bank2_lget(uaecptr addr)
 {
 	addr &= NEXT_ram_bank2_mask;
-	return do_get_mem_long(NEXTRam + addr);
+	return do_get_ram_long(NEXTRam + addr);
 }
 
 static uae_u32 mem_ram_bank2_wget(uaecptr addr)
 {
 	addr &= NEXT_ram_bank2_mask;
-	return do_get_mem_word(NEXTRam + addr);
+	return do_get_ram_word(NEXTRam + addr);
 }
 
 static uae_u32 mem_ram_bank2_bget(uaecptr addr)
 {
 	addr &= NEXT_ram_bank2_mask;
-	return NEXTRam[addr];
+	return do_get_ram_byte(NEXTRam + addr);
 }
 
 static void mem_ram_bank2_lput(uaecptr addr, uae_u32 l)
 {
 	addr &= NEXT_ram_bank2_mask;
-	do_put_mem_long(NEXTRam + addr, l);
+	do_put_ram_long(NEXTRam + addr, l);
 }
 
 static void mem_ram_bank2_wput(uaecptr addr, uae_u32 w)
 {
 	addr &= NEXT_ram_bank2_mask;
-	do_put_mem_word(NEXTRam + addr, w);
+	do_put_ram_word(NEXTRam + addr, w);
 }
 
 static void mem_ram_bank2_bput(uaecptr addr, uae_u32 b)
 {
 	addr &= NEXT_ram_bank2_mask;
-	NEXTRam[addr] = b;
+	do_put_ram_byte(NEXTRam + addr, b);
 }
 
 
 static uae_u32 mem_ram_bank3_lget(uaecptr addr)
 {
 	addr &= NEXT_ram_bank3_mask;
-	return do_get_mem_long(NEXTRam + addr);
+	return do_get_ram_long(NEXTRam + addr);
 }
 
 static uae_u32 mem_ram_bank3_wget(uaecptr addr)
 {
 	addr &= NEXT_ram_bank3_mask;
-	return do_get_mem_word(NEXTRam + addr);
+	return do_get_ram_word(NEXTRam + addr);
 }
 
 static uae_u32 mem_ram_bank3_bget(uaecptr addr)
 {
 	addr &= NEXT_ram_bank3_mask;
-	return NEXTRam[addr];
+	return do_get_ram_byte(NEXTRam + addr);
 }
 
 static void mem_ram_bank3_lput(uaecptr addr, uae_u32 l)
 {
 	addr &= NEXT_ram_bank3_mask;
-	do_put_mem_long(NEXTRam + addr, l);
+	do_put_ram_long(NEXTRam + addr, l);
 }
 
 static void mem_ram_bank3_wput(uaecptr addr, uae_u32 w)
 {
 	addr &= NEXT_ram_bank3_mask;
-	do_put_mem_word(NEXTRam + addr, w);
+	do_put_ram_word(NEXTRam + addr, w);
 }
 
 static void mem_ram_bank3_bput(uaecptr addr, uae_u32 b)
 {
 	addr &= NEXT_ram_bank3_mask;
-	NEXTRam[addr] = b;
+	do_put_ram_byte(NEXTRam + addr, b);
 }
 
 /* **** NEXT RAM empty areas **** */
@@ -961,7 +961,10 @@ static addrbank VRAM_bank =
 {
 	mem_video_lget, mem_video_wget, mem_video_bget,
 	mem_video_lput, mem_video_wput, mem_video_bput,
-	mem_video_lget, mem_video_wget, ABFLAG_RAM
+	mem_video_lget, mem_video_wget, ABFLAG_RAM,
+#ifndef ENABLE_HOST_ORDER_RAM /* the screen code reads VRAM in guest order */
+	NEXTVideo, NEXT_VRAM_MASK
+#endif
 };
 
 static addrbank VRAM_mwf_bank =
@@ -975,7 +978,10 @@ static addrbank VRAM_color_bank =
 {
 	mem_color_video_lget, mem_color_video_wget, mem_color_video_bget,
 	mem_color_video_lput, mem_color_video_wput, mem_color_video_bput,
-	mem_color_video_lget, mem_color_video_wget, ABFLAG_RAM
+	mem_color_video_lget, mem_color_video_wget, ABFLAG_RAM,
+#ifndef ENABLE_HOST_ORDER_RAM /* the screen code reads VRAM in guest order */
+	NEXTColorVideo, NEXT_VRAM_COLOR_MASK
+#endif
 };
 
 static addrbank IO_bank =
@@ -1071,6 +1077,8 @@ const char* memory_init(int *nNewNEXTMemSize)
 	/* Map main memory */
 	if (nNewNEXTMemSize[0]) {
 		NEXT_ram_bank0_mask = NEXT_ram_bank_mask|((nNewNEXTMemSize[0]<<20)-1);
+		RAM_bank0.baseaddr = NEXTRam;
+		RAM_bank0.mask     = NEXT_ram_bank0_mask;
 		map_banks(&RAM_bank0, bankstart[0]>>16, NEXT_ram_bank_size >> 16);
 		write_log("Mapping main memory bank0 at $%08x: %iMB\n", bankstart[0], nNewNEXTMemSize[0]);
 	} else {
@@ -1081,6 +1089,8 @@ const char* memory_init(int *nNewNEXTMemSize)
 	
 	if (nNewNEXTMemSize[1]) {
 		NEXT_ram_bank1_mask = NEXT_ram_bank_mask|((nNewNEXTMemSize[1]<<20)-1);
+		RAM_bank1.baseaddr = NEXTRam;
+		RAM_bank1.mask     = NEXT_ram_bank1_mask;
 		map_banks(&RAM_bank1, bankstart[1]>>16, NEXT_ram_bank_size >> 16);
 		write_log("Mapping main memory bank1 at $%08x: %iMB\n", bankstart[1], nNewNEXTMemSize[1]);
 	} else {
@@ -1091,6 +1101,8 @@ const char* memory_init(int *nNewNEXTMemSize)
 	
 	if (nNewNEXTMemSize[2]) {
 		NEXT_ram_bank2_mask = NEXT_ram_bank_mask|((nNewNEXTMemSize[2]<<20)-1);
+		RAM_bank2.baseaddr = NEXTRam;
+		RAM_bank2.mask     = NEXT_ram_bank2_mask;
 		map_banks(&RAM_bank2, bankstart[2]>>16, NEXT_ram_bank_size >> 16);
 		write_log("Mapping main memory bank2 at $%08x: %iMB\n", bankstart[2], nNewNEXTMemSize[2]);
 	} else {
@@ -1101,6 +1113,8 @@ const char* memory_init(int *nNewNEXTMemSize)
 	
 	if (nNewNEXTMemSize[3]) {
 		NEXT_ram_bank3_mask = NEXT_ram_bank_mask|((nNewNEXTMemSize[3]<<20)-1);
+		RAM_bank3.baseaddr = NEXTRam;
+		RAM_bank3.mask     = NEXT_ram_bank3_mask;
 		map_banks(&RAM_bank3, bankstart[3]>>16, NEXT_ram_bank_size >> 16);
 		write_log("Mapping main memory bank3 at $%08x: %iMB\n", bankstart[3], nNewNEXTMemSize[3]);
 	} else {
@@ -62,6 +62,10 @@ typedef struct {
 	mem_put_func lput, wput, bput;
 	mem_get_func lgeti, wgeti;
 	int flags;
+	/* Host memory for directly addressable banks or NULL. The host address
+	 * of addr is baseaddr + (addr & mask). */
+	uae_u8 *baseaddr;
+	uae_u32 mask;
 } addrbank;
 
 extern uae_u8 ce_cachable[65536];
@@ -113,34 +117,58 @@ void byteput(uaecptr addr, uae_u32 b);
 #define wordput(addr,w) (call_mem_put_func(get_mem_bank(addr).wput, addr, w))
 #define byteput(addr,b) (call_mem_put_func(get_mem_bank(addr).bput, addr, b))
 
+/* Accesses to RAM and VRAM go directly to host memory, everything else
+ * through the bank functions. Direct memory uses the RAM layout from
+ * maccess.h, see do_get_ram_long. */
 static inline uae_u32 get_long(uaecptr addr)
 {
-    return longget(addr);
+    addrbank *ab = &get_mem_bank(addr);
+    if (ab->baseaddr)
+        return do_get_ram_long(ab->baseaddr + (addr & ab->mask));
+    return call_mem_get_func(ab->lget, addr);
 }
 
 static inline uae_u32 get_word(uaecptr addr)
 {
-    return wordget(addr);
+    addrbank *ab = &get_mem_bank(addr);
+    if (ab->baseaddr)
+        return do_get_ram_word(ab->baseaddr + (addr & ab->mask));
+    return call_mem_get_func(ab->wget, addr);
 }
 
 static inline uae_u32 get_byte(uaecptr addr)
 {
-    return byteget(addr);
+    addrbank *ab = &get_mem_bank(addr);
+    if (ab->baseaddr)
+        return do_get_ram_byte(ab->baseaddr + (addr & ab->mask));
+    return call_mem_get_func(ab->bget, addr);
 }
 
 static inline void put_long(uaecptr addr, uae_u32 l)
 {
-    longput(addr, l);
+    addrbank *ab = &get_mem_bank(addr);
+    if (ab->baseaddr)
+        do_put_ram_long(ab->baseaddr + (addr & ab->mask), l);
+    else
+        call_mem_put_func(ab->lput, addr, l);
 }
 
 static inline void put_word(uaecptr addr, uae_u32 w)
 {
-    wordput(addr, w);
+    addrbank *ab = &get_mem_bank(addr);
+    if (ab->baseaddr)
+        do_put_ram_word(ab->baseaddr + (addr & ab->mask), w);
+    else
+        call_mem_put_func(ab->wput, addr, w);
 }
 
 static inline void put_byte(uaecptr addr, uae_u32 b)
 {
-    byteput(addr, b);
+    addrbank *ab = &get_mem_bank(addr);
+    if (ab->baseaddr)
+        do_put_ram_byte(ab->baseaddr + (addr & ab->mask), b);
+    else
+        call_mem_put_func(ab->bput, addr, b);
 }
 
 static inline uae_u32 get_longi(uaecptr addr)
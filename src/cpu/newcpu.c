@@ -70,6 +70,7 @@ const int imm8_table[] = { 8, 1, 2, 3, 4, 5, 6, 7 };
 int movem_index1[256];
 int movem_index2[256];
 int movem_next[256];
+int movem_count[256];
 
 cpuop_func *cpufunctbl[65536];
 
@@ -184,6 +185,109 @@ static void set_x_funcs (void)
 	}
 }
 
+/* Previous: blocks of decoded instructions for the 68040 with enabled
+ * instruction cache. Straight-line code is recorded while it executes and
+ * replayed without opcode fetch and table lookup. Blocks are keyed by the
+ * virtual address of their first instruction like the icache they follow,
+ * and are dropped with it by CINV/CPUSH, CACR writes and resets.
+ */
+#define DECODED_BLOCKS    1024
+#define DECODED_BLOCK_LEN 16
+
+struct decoded_insn {
+	uaecptr pc;
+	uae_u16 opcode;
+	cpuop_func *handler;
+};
+
+struct decoded_block {
+	uaecptr start;
+	int s;
+	int len;
+	struct decoded_insn insn[DECODED_BLOCK_LEN];
+};
+
+static struct decoded_block decoded_blocks[DECODED_BLOCKS];
+static struct decoded_block *decoded_block;
+static int decoded_idx;
+static bool decoded_enabled;
+static const struct cpufused *cpufused;
+
+#if defined(ENABLE_THREADED_DISPATCH) && defined(__GNUC__)
+#define THREADED_DISPATCH
+#include "cputbl.h"
+/* Label of m68k_run_mmu030_threaded for each opcode, rebuilt there after
+ * build_cpufunctbl */
+static const void *thr030tbl[65536];
+static bool thr030_valid;
+#endif
+
+void flush_decoded_blocks (void)
+{
+	int i;
+
+	for (i = 0; i < DECODED_BLOCKS; i++)
+		decoded_blocks[i].start = 0xffffffff;
+	decoded_block = NULL;
+}
+
+/* Run a recorded instruction through a fused handler if it forms a hot
+ * pair with the one recorded after it. */
+static void fuse_decoded_insn (struct decoded_insn *prev, struct decoded_insn *di)
+{
+	const struct cpufused *f;
+
+	if (!cpufused)
+		return;
+	for (f = cpufused; f->handler; f++) {
+		if (cpufunctbl[prev->opcode] == cpufunctbl[f->first]
+			&& cpufunctbl[di->opcode] == cpufunctbl[f->second]) {
+			prev->handler = f->handler;
+			return;
+		}
+	}
+}
+
+/* Return the decoded instruction at pc. Continues the current block if pc
+ * follows it, appends to the block while it is still being recorded or
+ * starts a new one. May throw a bus error from the opcode fetch. */
+static struct decoded_insn *get_decoded_insn (uaecptr pc)
+{
+	struct decoded_block *b = decoded_block;
+	struct decoded_insn *di;
+	uae_u16 opcode;
+
+	if (b && b->s == regs.s) {
+		if (decoded_idx < b->len) {
+			if (b->insn[decoded_idx].pc == pc)
+				return &b->insn[decoded_idx++];
+		} else if (b->len < DECODED_BLOCK_LEN) {
+			opcode = x_prefetch (0);
+			di = &b->insn[b->len++];
+			di->pc      = pc;
+			di->opcode  = opcode;
+			di->handler = cpufunctbl[opcode];
+			fuse_decoded_insn (di - 1, di);
+			decoded_idx = b->len;
+			return di;
+		}
+	}
+
+	b = &decoded_blocks[(pc >> 1) & (DECODED_BLOCKS - 1)];
+	if (b->start != pc || b->s != regs.s) {
+		opcode = x_prefetch (0);
+		b->start = pc;
+		b->s     = regs.s;
+		b->len   = 1;
+		b->insn[0].pc      = pc;
+		b->insn[0].opcode  = opcode;
+		b->insn[0].handler = cpufunctbl[opcode];
+	}
+	decoded_block = b;
+	decoded_idx   = 1;
+	return &b->insn[0];
+}
+
 void set_cpu_caches (bool flush)
 {
 	int i;
@@ -243,6 +347,7 @@ void set_cpu_caches (bool flush)
         if(ConfigureParams.System.bRealtime) {
             if(regs.cacr & 0x8000) {
                 flush_icache(0, -1);
+                decoded_enabled = true;
                 x_prefetch   = getc_iword_mmu040;
                 x_get_ilong  = getc_ilong_mmu040;
                 x_get_iword  = getc_iword_mmu040;
@@ -250,6 +355,7 @@ void set_cpu_caches (bool flush)
                 x_next_iword = nextc_iword_mmu040;
                 x_next_ilong = nextc_ilong_mmu040;
             } else {
+                decoded_enabled = false;
                 x_prefetch   = get_iword_mmu040;
                 x_get_ilong  = get_ilong_mmu040;
                 x_get_iword  = get_iword_mmu040;
@@ -274,6 +380,7 @@ void build_cpufunctbl (void)
 	const struct cputbl *tbl = 0;
 	int lvl;
 
+	cpufused = NULL;
 	switch (currprefs.cpu_model)
 	{
 #ifdef CPUEMU_0
@@ -296,6 +403,7 @@ void build_cpufunctbl (void)
 //				tbl = op_smalltbl_23_ff;
 //			if (currprefs.mmu_model)
 				tbl = op_smalltbl_31_ff;
+				cpufused = op_fusedtbl_31_ff;
 //		}
 		break;
 	case 68030:
@@ -365,6 +473,9 @@ void build_cpufunctbl (void)
 			opcnt++;
 		}
 	}
+#ifdef THREADED_DISPATCH
+	thr030_valid = false;
+#endif
 	write_log ("Building CPU, %d opcodes (%d %d)\n",
 		opcnt, lvl, currprefs.cpu_compatible ? 1 : 0);
 	write_log ("CPU=%d, MMU=%d, FPU=%d ($%02x), JIT%s=%d, realtime=%d\n",
@@ -419,6 +530,9 @@ void check_prefs_changed_cpu (void)
 	if (currprefs.cpu_idle != changed_prefs.cpu_idle) {
 		currprefs.cpu_idle = changed_prefs.cpu_idle;
 	}
+	if (currprefs.fpu_strict != changed_prefs.fpu_strict) {
+		currprefs.fpu_strict = changed_prefs.fpu_strict;
+	}
 	if (changed)
 		set_special (SPCFLAG_MODE_CHANGE);
 
@@ -439,6 +553,7 @@ void init_m68k (void)
 		movem_index1[i] = j;
 		movem_index2[i] = 7-j;
 		movem_next[i] = i & (~(1 << j));
+		movem_count[i] = movem_count[i >> 1] + (i & 1);
 	}
 
 	write_log ("Building CPU table for configuration: %d", currprefs.cpu_model);
@@ -827,6 +942,8 @@ void REGPARAM2 MakeFromSR (void)
 	regs.s  = (regs.sr >> 13) & 1;
 	regs.m  = (regs.sr >> 12) & 1;
 	regs.intmask = (regs.sr >> 8) & 7;
+	/* Previous: a lower mask may unblock a pending interrupt */
+	set_special (SPCFLAG_IPL_CHANGE);
 	if (currprefs.cpu_model >= 68020) {
 		/* 68060 does not have MSP but does have M-bit.. */
 		if (currprefs.cpu_model >= 68060)
@@ -1647,8 +1764,6 @@ void doint (void)
 		set_special (SPCFLAG_DOINT);
 }
 
-#define IDLETIME (currprefs.cpu_idle * sleep_resolution / 700)
-
 /*
  * Handle special flags
  */
@@ -1671,12 +1786,30 @@ STATIC_INLINE int do_specialties (int cycles)
     /* Handle the STOP instruction */
     if ( regs.spcflags & SPCFLAG_STOP ) {
         while (regs.spcflags & SPCFLAG_STOP) {
-
+            int intr;
+            
             /* Take care of quit event if needed */
             if (regs.spcflags & SPCFLAG_BRK)
                 return 1;
-        
-            M68000_AddCycles(cpu_cycles);
+            
+            /* Leave STOP state if an interrupt is pending */
+            intr = intlev ();
+            if (intr > regs.intmask) {
+                do_interrupt (intr, false);
+                break;
+            }
+            
+            if (ConfigureParams.System.bRealtime) {
+                /* Sleep until the next event is due */
+                cycles = CycInt_Idle();
+            } else if (ConfigureParams.System.bIdleWarp) {
+                /* Fast-forward to the next event */
+                cycles = CycInt_Warp();
+            } else {
+                M68000_AddCycles(cpu_cycles);
+                cycles = cpu_cycles;
+            }
+            M68000_AddCoprocCycles(cycles);
 
             /* It is possible one or more ints happen at the same time */
             /* We must process them during the same cpu cycle until the special INT flag is set */
@@ -1690,27 +1823,6 @@ STATIC_INLINE int do_specialties (int cycles)
                     m68k_resumestopped ();
                     return 1;
                 }
-
-                if (currprefs.cpu_idle && ((regs.spcflags & SPCFLAG_STOP)) == SPCFLAG_STOP) {
-                    /* sleep 1ms if STOP-instruction is executed */
-                    if (1) {
-                        static int sleepcnt, lvpos;
-                        if (vpos != lvpos) {
-                            sleepcnt--;
-        #ifdef JIT
-                            if (pissoff == 0 && currprefs.cachesize && --zerocnt < 0) {
-                                sleepcnt = -1;
-                                zerocnt = IDLETIME / 4;
-                            }
-        #endif
-                            lvpos = vpos;
-                            if (sleepcnt < 0) {
-                                    /*sleepcnt = IDLETIME / 2; */  /* Laurent : badly removed for now */
-                                host_sleep_ms(1);
-                            }
-                        }
-                    }
-                }
             }
         }
 	}
@@ -1863,187 +1975,426 @@ static void opcodedebug (uae_u32 pc, uae_u16 opcode)
 #endif
 
 static int lastRegsS = 0;
+static int lastintr030 = 0;
 
-// Previous MMU 68030
-static void m68k_run_mmu030 (void)
+/* Flags restored when a 68030 instruction faults. The instruction loops
+ * below run in their own functions, so the setjmp in TRY only affects the
+ * small wrappers around them and the hot loop keeps its locals in
+ * registers. */
+static struct flag_struct mmu030_flags;
+
+/* Restore the state of a faulted 68030 instruction and start its
+ * exception. Returns false if the CPU halted. */
+static bool m68k_mmu030_fault (struct flag_struct *f, m68k_exception save_except)
+{
+	regflags = *f;
+
+	m68k_setpc (regs.instruction_pc);
+
+	if (mmufixup[0].reg >= 0) {
+		m68k_areg (regs, mmufixup[0].reg) = mmufixup[0].value;
+		mmufixup[0].reg = -1;
+	}
+	if (mmufixup[1].reg >= 0) {
+		m68k_areg (regs, mmufixup[1].reg) = mmufixup[1].value;
+		mmufixup[1].reg = -1;
+	}
+
+	TRY (prb2) {
+		Exception (save_except);
+	} CATCH (prb2) {
+		cpu_halt (1);
+		return false;
+	} ENDTRY
+	return true;
+}
+
+static NOINLINE void m68k_run_mmu030_insns (bool phys)
 {
 	uae_u16 opcode;
 	uaecptr pc;
-	struct flag_struct f;
-	f.cznv = 0;
-	f.x    = 0;
-	m68k_exception save_except;
-    int intr             = 0;
-    int lastintr         = 0;
-	mmu030_opcode_stageb = -1;
-retry:
-	TRY (prb) {
-		for (;;) {
-			int cnt;
+	struct flag_struct *f = &mmu030_flags;
+	int intr = 0;
+
+	for (;;) {
+		int cnt;
 insretry:
-			pc = regs.instruction_pc = m68k_getpc ();
-			f.cznv = regflags.cznv;
-			f.x    = regflags.x;
-            
-			mmu030_state[0] = mmu030_state[1] = mmu030_state[2] = 0;
-			mmu030_opcode = -1;
-			if (mmu030_opcode_stageb < 0) {
-				opcode = get_iword_mmu030 (0);
-			} else {
-				opcode = mmu030_opcode_stageb;
-				mmu030_opcode_stageb = -1;
-			}
+		pc = regs.instruction_pc = m68k_getpc ();
+		*f = regflags;
+        
+		mmu030_state[0] = mmu030_state[1] = mmu030_state[2] = 0;
+		mmu030_opcode = -1;
+		if (mmu030_opcode_stageb < 0) {
+			opcode = phys ? phys_get_word (pc) : get_iword_mmu030 (0);
+		} else {
+			opcode = mmu030_opcode_stageb;
+			mmu030_opcode_stageb = -1;
+		}
 
-			mmu030_opcode = opcode;
-			mmu030_ad[0].done = false;
-
-            Uint64 beforeCycles = nCyclesMainCounter;
-			cnt = 50;
-			for (;;) {
-				opcode = mmu030_opcode;
-				mmu030_idx = 0;
-				mmu030_retry = false;
-				cpu_cycles = (*cpufunctbl[opcode])(opcode);
-				cnt--; // so that we don't get in infinite loop if things go horribly wrong
-				if (!mmu030_retry)
-					break;
-				if (cnt < 0) {
-					cpu_halt (9);
-					break;
-				}
-				if (mmu030_retry && mmu030_opcode == -1)
-					goto insretry; // urgh
-			}
+		mmu030_opcode = opcode;
+		mmu030_ad[0].done = false;
 
-			mmu030_opcode = -1;
-            
-            M68000_AddCycles(cpu_cycles);
-            cpu_cycles = nCyclesMainCounter - beforeCycles;
-            
-			DSP_Run(cpu_cycles);
-            i860_Run(cpu_cycles);
-
-			/* We can have several interrupts at the same time before the next CPU instruction */
-			/* We must check for pending interrupt and call do_specialties_interrupt() only */
-			/* if the cpu is not in the STOP state. Else, the int could be acknowledged now */
-			/* and prevent exiting the STOP state when calling do_specialties() after. */
-			/* For performance, we first test PendingInterruptCount, then regs.spcflags */
-			while ( ( PendingInterrupt.time <= 0 ) && ( PendingInterrupt.pFunction ) && ( ( regs.spcflags & SPCFLAG_STOP ) == 0 ) ) {
-				CALL_VAR(PendingInterrupt.pFunction);		/* call the interrupt handler */
+        Uint64 beforeCycles = nCyclesMainCounter;
+		cnt = 50;
+		for (;;) {
+			opcode = mmu030_opcode;
+			mmu030_idx = 0;
+			mmu030_retry = false;
+			cpu_cycles = (*cpufunctbl[opcode])(opcode);
+			cnt--; // so that we don't get in infinite loop if things go horribly wrong
+			if (!mmu030_retry)
+				break;
+			if (cnt < 0) {
+				cpu_halt (9);
+				break;
 			}
+			if (mmu030_retry && mmu030_opcode == -1)
+				goto insretry; // urgh
+		}
+
+		mmu030_opcode = -1;
+        
+        M68000_AddCycles(cpu_cycles);
+        cpu_cycles = nCyclesMainCounter - beforeCycles;
+        
+		M68000_AddCoprocCycles(cpu_cycles);
+
+		/* We can have several interrupts at the same time before the next CPU instruction */
+		/* We must check for pending interrupt and call do_specialties_interrupt() only */
+		/* if the cpu is not in the STOP state. Else, the int could be acknowledged now */
+		/* and prevent exiting the STOP state when calling do_specialties() after. */
+		/* For performance, we first test PendingInterruptCount, then regs.spcflags */
+		while ( ( PendingInterrupt.time <= 0 ) && ( PendingInterrupt.pFunction ) && ( ( regs.spcflags & SPCFLAG_STOP ) == 0 ) ) {
+			CALL_VAR(PendingInterrupt.pFunction);		/* call the interrupt handler */
+		}
 
-            /* Previous: for now we poll the interrupt pins with every instruction.
-             * TODO: only do this when an actual interrupt is active to not
-             * unneccessarily slow down emulation.
-             */
+        /* Previous: the interrupt pins are only checked if sysReg.c signals
+         * a new interrupt level or MakeFromSR() a new interrupt mask.
+         */
+        if (regs.spcflags & SPCFLAG_IPL_CHANGE) {
+            unset_special (SPCFLAG_IPL_CHANGE);
             intr = intlev ();
-            if (intr>regs.intmask || (intr==7 && intr>lastintr))
+            if (intr>regs.intmask || (intr==7 && intr>lastintr030))
                 do_interrupt (intr, false);
-            lastintr = intr;
-            
-            if(lastRegsS != regs.s) {
-                host_realtime(!(regs.s));
-                lastRegsS = regs.s;
-            }
+            lastintr030 = intr;
+        }
+        
+        if(lastRegsS != regs.s) {
+            host_realtime(!(regs.s));
+            lastRegsS = regs.s;
+        }
 
-            if (regs.spcflags & ~SPCFLAG_INT) {
-				if (do_specialties (cpu_cycles))
-					return;
-			}
+        if (regs.spcflags & ~SPCFLAG_INT) {
+			if (do_specialties (cpu_cycles))
+				return;
 		}
-	} CATCH (prb) {
-		save_except = __exvalue;
+	}
+}
 
-		regflags.cznv = f.cznv;
-		regflags.x    = f.x;
+#ifdef THREADED_DISPATCH
 
-		m68k_setpc (regs.instruction_pc);
+struct thread_op {
+	cpuop_func *handler;
+	const void *label;
+};
 
-		if (mmufixup[0].reg >= 0) {
-			m68k_areg (regs, mmufixup[0].reg) = mmufixup[0].value;
-			mmufixup[0].reg = -1;
-		}
-		if (mmufixup[1].reg >= 0) {
-			m68k_areg (regs, mmufixup[1].reg) = mmufixup[1].value;
-			mmufixup[1].reg = -1;
+static int thread_op_cmp (const void *a, const void *b)
+{
+	uintptr_t x = (uintptr_t)((const struct thread_op *)a)->handler;
+	uintptr_t y = (uintptr_t)((const struct thread_op *)b)->handler;
+
+	return x < y ? -1 : x > y;
+}
+
+/* Start of an instruction in m68k_run_mmu030_threaded */
+static uae_u16 mmu030_fetch_opcode (bool phys)
+{
+	uaecptr pc = regs.instruction_pc = m68k_getpc ();
+	uae_u16 opcode;
+
+	mmu030_flags = regflags;
+	mmu030_state[0] = mmu030_state[1] = mmu030_state[2] = 0;
+	mmu030_opcode = -1;
+	if (mmu030_opcode_stageb < 0) {
+		opcode = phys ? phys_get_word (pc) : get_iword_mmu030 (0);
+	} else {
+		opcode = mmu030_opcode_stageb;
+		mmu030_opcode_stageb = -1;
+	}
+	mmu030_opcode = opcode;
+	mmu030_ad[0].done = false;
+	return opcode;
+}
+
+/* Previous: threaded version of m68k_run_mmu030_insns. Every 68030
+ * handler gets a label that calls it directly and ends in its own "goto *"
+ * to the next opcode, so the host can predict each dispatch from the
+ * instruction before it. The tail only does the cycle accounting;
+ * anything else the loop checks between two instructions goes through
+ * thr_slow. Handlers without a label (op_illg_1)
+ * are called through cpufunctbl in thr_indirect. */
+static NOINLINE void m68k_run_mmu030_threaded (bool phys)
+{
+	static struct thread_op ops[] = {
+#define THREAD_OP_31(f)
+#define THREAD_OP_32(f) { f, &&thr_##f },
+#include "cputhr.h"
+#undef THREAD_OP_32
+	};
+	uae_u16 opcode;
+	Uint64 beforeCycles;
+	int intr = 0;
+	int cnt;
+
+	if (!thr030_valid) {
+		int nops = sizeof ops / sizeof ops[0];
+		int i;
+
+		qsort (ops, nops, sizeof ops[0], thread_op_cmp);
+		for (i = 0; i < 65536; i++) {
+			struct thread_op key, *op;
+
+			key.handler = cpufunctbl[i];
+			op = (struct thread_op *)bsearch (&key, ops, nops, sizeof ops[0], thread_op_cmp);
+			thr030tbl[i] = op ? op->label : &&thr_indirect;
 		}
+		thr030_valid = true;
+	}
+
+#define THREAD_FETCH \
+	opcode = mmu030_fetch_opcode (phys); \
+	beforeCycles = nCyclesMainCounter; \
+	cnt = 50; \
+	mmu030_idx = 0; \
+	mmu030_retry = false; \
+	goto *thr030tbl[opcode]
+
+#define THREAD_NEXT \
+	if (mmu030_retry) \
+		goto thr_retry; \
+	mmu030_opcode = -1; \
+	M68000_AddCycles (cpu_cycles); \
+	cpu_cycles = nCyclesMainCounter - beforeCycles; \
+	M68000_AddCoprocCycles (cpu_cycles); \
+	if (PendingInterrupt.time <= 0 || regs.spcflags || lastRegsS != regs.s) \
+		goto thr_slow; \
+	THREAD_FETCH
+
+thr_fetch:
+	THREAD_FETCH;
+
+#define THREAD_OP_32(f) \
+thr_##f: \
+	cpu_cycles = f (opcode); \
+	THREAD_NEXT;
+#include "cputhr.h"
+#undef THREAD_OP_32
+#undef THREAD_OP_31
+
+thr_indirect:
+	cpu_cycles = (*cpufunctbl[opcode])(opcode);
+	THREAD_NEXT;
+
+thr_retry:
+	if (--cnt < 0) {
+		cpu_halt (9);
+		mmu030_opcode = -1;
+		M68000_AddCycles (cpu_cycles);
+		cpu_cycles = nCyclesMainCounter - beforeCycles;
+		M68000_AddCoprocCycles (cpu_cycles);
+		goto thr_slow;
+	}
+	if (mmu030_opcode == -1)
+		goto thr_fetch;
+	opcode = mmu030_opcode;
+	mmu030_idx = 0;
+	mmu030_retry = false;
+	goto *thr030tbl[opcode];
+
+thr_slow:
+	/* Same as the end of m68k_run_mmu030_insns */
+	while ( ( PendingInterrupt.time <= 0 ) && ( PendingInterrupt.pFunction ) && ( ( regs.spcflags & SPCFLAG_STOP ) == 0 ) ) {
+		CALL_VAR(PendingInterrupt.pFunction);
+	}
+	if (regs.spcflags & SPCFLAG_IPL_CHANGE) {
+		unset_special (SPCFLAG_IPL_CHANGE);
+		intr = intlev ();
+		if (intr>regs.intmask || (intr==7 && intr>lastintr030))
+			do_interrupt (intr, false);
+		lastintr030 = intr;
+	}
+	if (lastRegsS != regs.s) {
+		host_realtime(!(regs.s));
+		lastRegsS = regs.s;
+	}
+	if (regs.spcflags & ~SPCFLAG_INT) {
+		if (do_specialties (cpu_cycles))
+			return;
+	}
+	goto thr_fetch;
 
-		TRY (prb2) {
-			Exception (save_except);
-		} CATCH (prb2) {
-			cpu_halt (1);
+#undef THREAD_NEXT
+#undef THREAD_FETCH
+}
+
+#endif /* THREADED_DISPATCH */
+
+// Previous MMU 68030
+/* With phys set, address translation is disabled. This is the case in the
+ * ROM monitor, during POST and early boot, and the opcode is fetched from
+ * physical memory directly. Bus errors still need the 68030 exception
+ * state, so the access bookkeeping and instruction restart stay.
+ * mmu030_decode_tc() sets SPCFLAG_MODE_CHANGE when TC turns translation
+ * on or off, which makes m68k_go() pick the matching entry point. */
+static void m68k_run_mmu030_loop (bool phys)
+{
+	m68k_exception save_except;
+	mmu030_flags.cznv = 0;
+	mmu030_flags.x    = 0;
+	mmu030_opcode_stageb = -1;
+	set_special (SPCFLAG_IPL_CHANGE);
+retry:
+	TRY (prb) {
+#ifdef THREADED_DISPATCH
+		if (ConfigureParams.System.bThreadedDispatch)
+			m68k_run_mmu030_threaded (phys);
+		else
+#endif
+		m68k_run_mmu030_insns (phys);
+		return;
+	} CATCH (prb) {
+		save_except = __exvalue;
+		if (!m68k_mmu030_fault (&mmu030_flags, save_except))
 			return;
-		} ENDTRY
 	} ENDTRY
     goto retry;
 }
 
-/* Aranym MMU 68040  */
-static void m68k_run_mmu040 (void)
+static void m68k_run_mmu030 (void)
+{
+	m68k_run_mmu030_loop (false);
+}
+
+static void m68k_run_mmu030_phys (void)
+{
+	m68k_run_mmu030_loop (true);
+}
+
+/* Flags restored when an instruction is restarted. Kept outside of
+ * m68k_run_mmu040 because m68k_fuse_next starts instructions, too. */
+static struct flag_struct mmu040_flags;
+static int lastintr040 = 0;
+
+/* Previous: called by the fused handlers generated from fused.68k after
+ * the first instruction of a pair. Does what the run loop would do before
+ * the next instruction and returns false if the loop has to see it first
+ * or the second instruction has not been recorded in the decoded block. */
+bool m68k_fuse_next (uae_u32 *opcode, uae_u32 cycles)
+{
+	struct decoded_block *b = decoded_block;
+	struct decoded_insn *di;
+	uaecptr pc;
+
+	if (regs.spcflags || regs.s != lastRegsS || PendingInterrupt.time <= (int)cycles)
+		return false;
+	if (!b || decoded_idx >= b->len)
+		return false;
+	pc = m68k_getpc ();
+	di = &b->insn[decoded_idx];
+	if (di->pc != pc)
+		return false;
+
+	M68000_AddCycles (cycles);
+	decoded_idx++;
+	mmu040_flags = regflags;
+	mmu_restart = true;
+	regs.instruction_pc = pc;
+	mmu_opcode = *opcode = di->opcode;
+	return true;
+}
+
+/* Instruction loop of m68k_run_mmu040. Like the 68030 loops it runs
+ * outside of the function that calls setjmp. */
+static NOINLINE void m68k_run_mmu040_insns (void)
 {
 	uae_u16 opcode;
-	struct flag_struct f;
-	f.cznv = 0;
-	f.x    = 0;
+	struct flag_struct *f = &mmu040_flags;
 	uaecptr pc;
-	m68k_exception save_except;
-    int intr = 0;
-    int lastintr = 0;
-	
+	int intr = 0;
+
 	for (;;) {
-	TRY (prb) {
-		for (;;) {
-			f.cznv = regflags.cznv;
-			f.x = regflags.x;
-			mmu_restart = true;
-			pc = regs.instruction_pc = m68k_getpc ();
-        
-            Uint64 beforeCycles = nCyclesMainCounter;
-			mmu_opcode = -1;
+		*f = regflags;
+		mmu_restart = true;
+		pc = regs.instruction_pc = m68k_getpc ();
+    
+        Uint64 beforeCycles = nCyclesMainCounter;
+		mmu_opcode = -1;
+		if (decoded_enabled) {
+			struct decoded_insn *di = get_decoded_insn (pc);
+			mmu_opcode = opcode = di->opcode;
+			cpu_cycles = (*di->handler)(opcode);
+		} else {
 			mmu_opcode = opcode = x_prefetch (0);
 			cpu_cycles = (*cpufunctbl[opcode])(opcode);
-            M68000_AddCycles(cpu_cycles);
-            
-            cpu_cycles = nCyclesMainCounter - beforeCycles;
-
-			DSP_Run(cpu_cycles);
-            i860_Run(cpu_cycles);
-
-			/* We can have several interrupts at the same time before the next CPU instruction */
-			/* We must check for pending interrupt and call do_specialties_interrupt() only */
-			/* if the cpu is not in the STOP state. Else, the int could be acknowledged now */
-			/* and prevent exiting the STOP state when calling do_specialties() after. */
-			/* For performance, we first test PendingInterruptCount, then regs.spcflags */
-			while ( ( PendingInterrupt.time <= 0 ) && ( PendingInterrupt.pFunction ) && ( ( regs.spcflags & SPCFLAG_STOP ) == 0 ) ) {
-				CALL_VAR(PendingInterrupt.pFunction);		/* call the interrupt handler */
-			}
+		}
+        M68000_AddCycles(cpu_cycles);
+        
+        cpu_cycles = nCyclesMainCounter - beforeCycles;
+
+		M68000_AddCoprocCycles(cpu_cycles);
+
+		/* We can have several interrupts at the same time before the next CPU instruction */
+		/* We must check for pending interrupt and call do_specialties_interrupt() only */
+		/* if the cpu is not in the STOP state. Else, the int could be acknowledged now */
+		/* and prevent exiting the STOP state when calling do_specialties() after. */
+		/* For performance, we first test PendingInterruptCount, then regs.spcflags */
+		while ( ( PendingInterrupt.time <= 0 ) && ( PendingInterrupt.pFunction ) && ( ( regs.spcflags & SPCFLAG_STOP ) == 0 ) ) {
+			CALL_VAR(PendingInterrupt.pFunction);		/* call the interrupt handler */
+		}
 
-            /* Previous: for now we poll the interrupt pins with every instruction.
-             * TODO: only do this when an actual interrupt is active to not
-             * unneccessarily slow down emulation.
-             */
+        /* Previous: the interrupt pins are only checked if sysReg.c signals
+         * a new interrupt level or MakeFromSR() a new interrupt mask.
+         */
+        if (regs.spcflags & SPCFLAG_IPL_CHANGE) {
+            unset_special (SPCFLAG_IPL_CHANGE);
             intr = intlev ();
-            if (intr>regs.intmask || (intr==7 && intr>lastintr))
+            if (intr>regs.intmask || (intr==7 && intr>lastintr040))
                 do_interrupt (intr, false);
-            lastintr = intr;
-            
-            if(lastRegsS != regs.s) {
-                host_realtime(!(regs.s));
-                lastRegsS = regs.s;
-            }
-            
-			if (regs.spcflags & ~SPCFLAG_INT) {
-				if (do_specialties (cpu_cycles))
-					return;
-			}
-		} // end of for(;;)
+            lastintr040 = intr;
+        }
+        
+        if(lastRegsS != regs.s) {
+            host_realtime(!(regs.s));
+            lastRegsS = regs.s;
+        }
+        
+		if (regs.spcflags & ~SPCFLAG_INT) {
+			if (do_specialties (cpu_cycles))
+				return;
+		}
+	}
+}
+
+/* Aranym MMU 68040  */
+static void m68k_run_mmu040 (void)
+{
+	struct flag_struct *f = &mmu040_flags;
+	f->cznv = 0;
+	f->x    = 0;
+	m68k_exception save_except;
+	set_special (SPCFLAG_IPL_CHANGE);
+	
+	for (;;) {
+	TRY (prb) {
+		m68k_run_mmu040_insns ();
+		return;
 	} CATCH (prb) {
 		save_except = __exvalue;
+		mmu_split_clear ();
 
 		if (mmu_restart) {
 			/* restore state if instruction restart */
-			regflags.cznv = f.cznv;
-			regflags.x = f.x;
+			regflags = *f;
 			m68k_setpc (regs.instruction_pc);
 		}
 
@@ -2190,7 +2541,12 @@ void m68k_go (int may_quit)
 	if (mmu_enabled && !currprefs.cachesize) {
 			run_func = m68k_run_mmu;
 		} else {
-			run_func=currprefs.cpu_model == 68040 ? m68k_run_mmu040 : m68k_run_mmu030;
+			if (currprefs.cpu_model == 68040)
+				run_func = m68k_run_mmu040;
+			else if (mmu030_translation_enabled ())
+				run_func = m68k_run_mmu030;
+			else
+				run_func = m68k_run_mmu030_phys;
 		}
 		run_func ();
 	}
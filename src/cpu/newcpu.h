@@ -35,6 +35,7 @@
 #define SPCFLAG_DOINT 0x100
 #define SPCFLAG_EXEC 0x400
 #define SPCFLAG_MODE_CHANGE 0x800
+#define SPCFLAG_IPL_CHANGE 0x1000
 
 
 #ifndef SET_CFLG
@@ -67,6 +68,7 @@ extern const int imm8_table[];
 extern int movem_index1[256];
 extern int movem_index2[256];
 extern int movem_next[256];
+extern int movem_count[256];
 
 #ifdef FPUEMU
 extern int fpp_movem_index1[256];
@@ -84,6 +86,13 @@ struct cputbl {
 	uae_u16 opcode;
 };
 
+/* Previous: handler for a hot instruction pair, see fused.68k */
+struct cpufused {
+	cpuop_func *handler;
+	uae_u16 first;
+	uae_u16 second;
+};
+
 #ifdef JIT
 typedef uae_u32 REGPARAM3 compop_func (uae_u32) REGPARAM;
 
@@ -483,6 +492,7 @@ extern const struct cputbl op_smalltbl_33_ff[]; // MMU
 extern const struct cputbl op_smalltbl_1_ff[];
 extern const struct cputbl op_smalltbl_23_ff[]; // CE
 extern const struct cputbl op_smalltbl_31_ff[]; // MMU
+extern const struct cpufused op_fusedtbl_31_ff[];
 /* 68030 */
 extern const struct cputbl op_smalltbl_2_ff[];
 extern const struct cputbl op_smalltbl_24_ff[]; // CE
@@ -512,6 +522,8 @@ bool check_prefs_changed_comp (void);
 #else
 void flush_icache(uaecptr, int);
 #endif
+void flush_decoded_blocks (void);
+bool m68k_fuse_next (uae_u32 *opcode, uae_u32 cycles);
 void flush_dcache (uaecptr, int);
 void flush_mmu (uaecptr, int);
 
@@ -23,7 +23,11 @@
 
 //#define DEBUGGER
 #define FILESYS /* filesys emulation */
-//#define JIT /* JIT compiler support */
+/* JIT compiler support. Stays disabled: the sources in jit/ need WinUAE's
+ * natmem direct memory mapping and only translate code that runs without
+ * the MMU, but NeXTstep enables the 68030/68040 MMU during boot and all
+ * memory goes through the Previous banks. */
+//#define JIT
 #define NATMEM_OFFSET natmem_offset
 #define USE_NORMAL_CALLING_CONVENTION 0
 #define USE_X86_FPUCW 1
@@ -4,17 +4,25 @@
   This file is distributed under the GNU Public License, version 2 or at
   your option any later version. Read the file gpl.txt for details.
 
-  This code handles our table with callbacks for cycle accurate program
-  interruption. We add any pending callback handler into a table so that we do
-  not need to test for every possible interrupt event. We then scan
-  the list if used entries in the table and copy the one with the least cycle
-  count into the global 'PendingInterrupt' variable. This is then
-  decremented by the execution loop - rather than decrement each and every
-  entry (as the others cannot occur before this one).
+  This code handles our event scheduler with callbacks for cycle accurate
+  program interruption. Every pending callback handler is kept in a binary
+  min-heap ordered by an absolute deadline in CPU cycles (nCyclesMainCounter),
+  so adding or removing an event is O(log n) and the next event is always at
+  the top of the heap. The number of cycles until the top event is copied into
+  the global 'PendingInterrupt' variable. This is then decremented by the
+  execution loop - rather than decrement each and every entry (as the others
+  cannot occur before this one).
   We support three time units: CPU cycles, ticks, and microseconds.
   Ticks are bound to CPU cycles and run at TICK_RATE MHz. Microseconds are either
   bound to the host CPU's performance counter in real-time mode or to the emulated
   CPU cycles if non-realtime mode.
+  Real-time microsecond events live in the same heap: their key is the
+  cycle count at which the host clock has to be checked next. When such an
+  entry reaches the top of the heap the host clock is read once and the event
+  either fires or is re-keyed closer to its deadline.
+  For every handler we keep statistics about how late it was called compared
+  to its deadline and how much host time it used. They are shown by the
+  "info cycint" debugger command and the periodic reports.
 */
 
 const char CycInt_fileid[] = "Previous cycInt.c : " __DATE__ " " __TIME__;
@@ -41,12 +49,11 @@ const char CycInt_fileid[] = "Previous cycInt.c : " __DATE__ " " __TIME__;
 
 void (*PendingInterruptFunction)(void);
 Sint64 PendingInterruptCounter;
-int    usCheckCycles;
 
-static Sint64 nCyclesOver;
 Sint64 nCyclesMainCounter;         /* Main cycles counter, counts emulated CPU cycles sind reset */
 
-static const Sint64 TICK_RATE = 8; /* Tick rate is 8MHz */
+static const Sint64 TICK_RATE    = 8;   /* Tick rate is 8MHz */
+static const Sint64 US_POLL_TIME = 100; /* Max. microseconds between host clock checks */
 
 /* List of possible interrupt handlers to be store in 'PendingInterruptTable',
  * used for 'MemorySnapShot' */
@@ -73,9 +80,67 @@ static void (* const pIntHandlerFunctions[MAX_INTERRUPTS])(void) =
     nd_video_vbl_handler,
 };
 
-static INTERRUPTHANDLER InterruptHandlers[MAX_INTERRUPTS];
+static const char* const IntNames[MAX_INTERRUPTS] =
+{
+	"null",
+	"vbl",
+	"hardclock",
+	"mouse",
+	"esp",
+	"esp_io",
+	"m2r",
+	"r2m",
+	"mo",
+	"mo_io",
+	"ecc_io",
+	"enet_io",
+	"flp_io",
+	"snd_out",
+	"snd_in",
+	"lp_io",
+	"event_loop",
+	"nd_vbl",
+	"nd_video_vbl",
+};
+
+/* Histograms use power of two buckets: bucket 0 counts values <= 0,
+ * bucket n counts values in [2^(n-1), 2^n). The last bucket is open. */
+#define CYCINT_HIST_SIZE 16
+
+/* Handler cost needs two performance counter reads, so only one in this
+ * many handler calls is timed. Must be a power of two. */
+#define CYCINT_COST_SAMPLE 16
+
+typedef struct
+{
+    Uint64  fired;                          /* Number of handler calls */
+    Uint64  timed;                          /* Number of calls with cost sampled */
+    Uint64  lateCycles[CYCINT_HIST_SIZE];   /* Lateness in CPU cycles */
+    Uint64  lateUs[CYCINT_HIST_SIZE];       /* Lateness in microseconds */
+    Uint64  costUs[CYCINT_HIST_SIZE];       /* Host time spent in timed calls */
+    Sint64  maxLateCycles;
+    Sint64  maxLateUs;
+    Uint64  maxCostTicks;                   /* Performance counter ticks */
+    Uint64  totalCostTicks;
+} CYCINT_STATS;
+
+static CYCINT_STATS     IntStats[MAX_INTERRUPTS];
+static CYCINT_STATS     IntStatsReported[MAX_INTERRUPTS];
+static Uint32           IntCostSample;
+
+typedef struct
+{
+    int     type;   /* Type of time (CPU Cycles, microseconds) or NONE for inactive */
+    Sint64  time;   /* Absolute deadline in CPU cycles or host microseconds */
+    Sint64  key;    /* Absolute CPU cycle count used to order the event heap */
+    int     pos;    /* Position in event heap, -1 if not queued */
+} CYCINT_EVENT;
+
+static CYCINT_EVENT     InterruptEvents[MAX_INTERRUPTS];
+static interrupt_id     EventHeap[MAX_INTERRUPTS];
+static int              EventHeapSize = 0;
 INTERRUPTHANDLER        PendingInterrupt;
-static int              ActiveInterrupt=0;
+static interrupt_id     ActiveInterrupt = INTERRUPT_NULL;
 
 static void CycInt_SetNewInterrupt(void);
 
@@ -83,103 +148,210 @@ extern Uint8 NEXTRom[0x20000];
 
 /*-----------------------------------------------------------------------*/
 /**
- * Reset interrupts, handlers
+ * Event heap helpers. The heap keeps the event with the lowest key at
+ * index 0 and tracks the heap position of every event for O(log n) removal.
  */
-void CycInt_Reset(void) {
-	int i;
+static inline void CycInt_HeapSet(int pos, interrupt_id id) {
+    EventHeap[pos]              = id;
+    InterruptEvents[id].pos     = pos;
+}
 
-	/* Reset counts */
-    PendingInterrupt.time = 0;
-	ActiveInterrupt       = 0;
-	nCyclesOver           = 0;
-    nCyclesMainCounter    = 0;
-    usCheckCycles         = 0;
-        
-	/* Reset interrupt table */
-	for (i=0; i<MAX_INTERRUPTS; i++) {
-		InterruptHandlers[i].type      = CYC_INT_NONE;
-		InterruptHandlers[i].time      = INT64_MAX;
-		InterruptHandlers[i].pFunction = pIntHandlerFunctions[i];
-	}
+static void CycInt_HeapUp(int pos) {
+    interrupt_id id  = EventHeap[pos];
+    Sint64       key = InterruptEvents[id].key;
+
+    while (pos > 0) {
+        int parent = (pos - 1) >> 1;
+        if (InterruptEvents[EventHeap[parent]].key <= key)
+            break;
+        CycInt_HeapSet(pos, EventHeap[parent]);
+        pos = parent;
+    }
+    CycInt_HeapSet(pos, id);
+}
+
+static void CycInt_HeapDown(int pos) {
+    interrupt_id id  = EventHeap[pos];
+    Sint64       key = InterruptEvents[id].key;
+
+    for (;;) {
+        int child = (pos << 1) + 1;
+        if (child >= EventHeapSize)
+            break;
+        if (child + 1 < EventHeapSize &&
+            InterruptEvents[EventHeap[child + 1]].key < InterruptEvents[EventHeap[child]].key)
+            child++;
+        if (key <= InterruptEvents[EventHeap[child]].key)
+            break;
+        CycInt_HeapSet(pos, EventHeap[child]);
+        pos = child;
+    }
+    CycInt_HeapSet(pos, id);
+}
+
+/* Insert event or move it to its new position after its key changed */
+static void CycInt_HeapUpdate(interrupt_id id) {
+    int pos = InterruptEvents[id].pos;
+
+    if (pos < 0) {
+        pos = EventHeapSize++;
+        CycInt_HeapSet(pos, id);
+        CycInt_HeapUp(pos);
+    } else {
+        CycInt_HeapUp(pos);
+        CycInt_HeapDown(InterruptEvents[id].pos);
+    }
+}
+
+static void CycInt_HeapRemove(interrupt_id id) {
+    int pos = InterruptEvents[id].pos;
+
+    if (pos < 0)
+        return;
+    InterruptEvents[id].pos = -1;
+    if (--EventHeapSize == pos)
+        return;
+    CycInt_HeapSet(pos, EventHeap[EventHeapSize]);
+    CycInt_HeapUp(pos);
+    CycInt_HeapDown(InterruptEvents[EventHeap[pos]].pos);
 }
 
 /*-----------------------------------------------------------------------*/
 /**
- * Find next interrupt to occur, and store to global variables for decrement
- * in instruction decode loop.
- * (SC) Microseconf interrupts are skipped here and handled in the decode loop.
+ * Compute the cycle count at which a microsecond event has to be checked.
  */
-static void CycInt_SetNewInterrupt(void) {
-	Sint64       LowestCycleCount = INT64_MAX;
-	interrupt_id LowestInterrupt  = INTERRUPT_NULL;
-    
-	/* Find next interrupt to go off */
-	for(int i = INTERRUPT_NULL+1; i < MAX_INTERRUPTS; i++) {
-        /* Is interrupt pending? */
-        if(InterruptHandlers[i].type == CYC_INT_CPU && InterruptHandlers[i].time < LowestCycleCount) {
-            LowestCycleCount = InterruptHandlers[i].time;
-            LowestInterrupt  = i;
-        }
-	}
-
-	/* Set new counts, active interrupt */
-    PendingInterrupt = InterruptHandlers[LowestInterrupt];
-	ActiveInterrupt  = LowestInterrupt;
+static Sint64 CycInt_UsPollKey(Sint64 us) {
+    if (us > US_POLL_TIME) us = US_POLL_TIME;
+    if (us < 1)            us = 1;
+    return nCyclesMainCounter + us * ConfigureParams.System.nCpuFreq;
 }
 
 /*-----------------------------------------------------------------------*/
 /**
- * Adjust all interrupt timings, MUST call CycInt_SetNewInterrupt after this.
+ * Statistics helpers.
  */
-static void CycInt_UpdateInterrupt(void) {
-	Sint64 CycleSubtract;
-	int i;
+static inline int CycInt_HistBucket(Sint64 value) {
+    int bucket = 0;
+    while (value > 0 && bucket < CYCINT_HIST_SIZE-1) {
+        value >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
 
-	/* Find out how many cycles we went over (<=0) */
-	nCyclesOver = PendingInterrupt.time;
-	/* Calculate how many cycles have passed, included time we went over */
-	CycleSubtract = InterruptHandlers[ActiveInterrupt].time - nCyclesOver;
+static Uint64 CycInt_TicksToUs(Uint64 ticks) {
+    Uint64 freq = SDL_GetPerformanceFrequency();
+    return (ticks / freq) * 1000000 + ((ticks % freq) * 1000000) / freq;
+}
 
-	/* Adjust table */
-	for (i = 0; i < MAX_INTERRUPTS; i++) {
-		if (InterruptHandlers[i].type == CYC_INT_CPU)
-			InterruptHandlers[i].time -= CycleSubtract;
-	}
+static void CycInt_UpdateStats(interrupt_id id, Sint64 lateCycles, Sint64 lateUs) {
+    CYCINT_STATS* stats = &IntStats[id];
+
+    stats->fired++;
+    stats->lateCycles[CycInt_HistBucket(lateCycles)]++;
+    stats->lateUs[CycInt_HistBucket(lateUs)]++;
+    if (lateCycles > stats->maxLateCycles) stats->maxLateCycles = lateCycles;
+    if (lateUs     > stats->maxLateUs)     stats->maxLateUs     = lateUs;
+}
+
+static void CycInt_UpdateCost(interrupt_id id, Uint64 costTicks) {
+    CYCINT_STATS* stats = &IntStats[id];
+
+    stats->timed++;
+    stats->costUs[CycInt_HistBucket(CycInt_TicksToUs(costTicks))]++;
+    if (costTicks  > stats->maxCostTicks)  stats->maxCostTicks  = costTicks;
+    stats->totalCostTicks += costTicks;
 }
 
 /*-----------------------------------------------------------------------*/
 /**
- * Check all microsecond interrupt timings
+ * Called from the decode loop when the event at the top of the heap is due.
+ * Microsecond events are only fired if the host clock passed their deadline,
+ * otherwise they are re-keyed closer to the deadline.
  */
-bool CycInt_SetNewInterruptUs(void) {
-    Sint64 now = host_time_us();
-    for(int i = 0; i < MAX_INTERRUPTS; i++) {
-        if (InterruptHandlers[i].type == CYC_INT_US && now > InterruptHandlers[i].time) {
-            PendingInterrupt = InterruptHandlers[i];
-            PendingInterrupt.time = -1;
-            ActiveInterrupt       = i;
-            return true;
+static void CycInt_CallHandler(void) {
+    interrupt_id id = ActiveInterrupt;
+    Sint64       lateCycles;
+    Sint64       lateUs;
+    Uint64       start;
+
+    if (InterruptEvents[id].type == CYC_INT_US) {
+        Sint64 now = host_time_us();
+        if (now < InterruptEvents[id].time) {
+            InterruptEvents[id].key = CycInt_UsPollKey(InterruptEvents[id].time - now);
+            CycInt_HeapDown(InterruptEvents[id].pos);
+            CycInt_SetNewInterrupt();
+            return;
         }
+        lateUs     = now - InterruptEvents[id].time;
+        lateCycles = lateUs * ConfigureParams.System.nCpuFreq;
+    } else {
+        lateCycles = nCyclesMainCounter - InterruptEvents[id].time;
+        lateUs     = lateCycles / ConfigureParams.System.nCpuFreq;
+    }
+
+    CycInt_UpdateStats(id, lateCycles, lateUs);
+    if (++IntCostSample & (CYCINT_COST_SAMPLE-1)) {
+        CALL_VAR(pIntHandlerFunctions[id]);
+        return;
     }
-    return false;
+    start = SDL_GetPerformanceCounter();
+    CALL_VAR(pIntHandlerFunctions[id]);
+    CycInt_UpdateCost(id, SDL_GetPerformanceCounter() - start);
 }
 
 /*-----------------------------------------------------------------------*/
 /**
- * Adjust all interrupt timings as 'ActiveInterrupt' has occured, and
- * remove from active list.
+ * Reset interrupts, handlers
  */
-void CycInt_AcknowledgeInterrupt(void) {
-	/* Update list cycle counts */
-	CycInt_UpdateInterrupt();
+void CycInt_Reset(void) {
+	int i;
 
-	/* Disable interrupt entry which has just occured */
-	InterruptHandlers[ActiveInterrupt].type = CYC_INT_NONE;
+	/* Reset counts */
+	ActiveInterrupt       = INTERRUPT_NULL;
+	EventHeapSize         = 0;
+    nCyclesMainCounter    = 0;
 
-	/* Set new */
+	/* Reset interrupt table */
+	for (i=0; i<MAX_INTERRUPTS; i++) {
+		InterruptEvents[i].type = CYC_INT_NONE;
+		InterruptEvents[i].time = INT64_MAX;
+		InterruptEvents[i].key  = INT64_MAX;
+		InterruptEvents[i].pos  = -1;
+	}
+
+	CycInt_ResetStats();
 	CycInt_SetNewInterrupt();
 }
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Take next interrupt to occur from the top of the heap, and store to
+ * global variables for decrement in instruction decode loop.
+ */
+static void CycInt_SetNewInterrupt(void) {
+	if (EventHeapSize == 0) {
+		PendingInterrupt.type      = CYC_INT_NONE;
+		PendingInterrupt.time      = INT64_MAX;
+		PendingInterrupt.pFunction = NULL;
+		ActiveInterrupt            = INTERRUPT_NULL;
+		return;
+	}
+
+	ActiveInterrupt            = EventHeap[0];
+	PendingInterrupt.type      = CYC_INT_CPU;
+	PendingInterrupt.time      = InterruptEvents[ActiveInterrupt].key - nCyclesMainCounter;
+	PendingInterrupt.pFunction = CycInt_CallHandler;
+}
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Remove 'ActiveInterrupt' which has just occured from the event heap.
+ */
+void CycInt_AcknowledgeInterrupt(void) {
+	CycInt_RemovePendingInterrupt(ActiveInterrupt);
+}
+
 /*-----------------------------------------------------------------------*/
 /**
  * Add interrupt to occur from now.
@@ -187,15 +359,12 @@ void CycInt_AcknowledgeInterrupt(void) {
 void CycInt_AddRelativeInterruptCycles(Sint64 CycleTime, interrupt_id Handler) {
 	assert(CycleTime >= 0);
 
-	/* Update list cycle counts with current PendingInterruptCount before adding a new int, */
-	/* because CycInt_SetNewInterrupt can change the active int / PendingInterruptCount */
-	if ( ActiveInterrupt > 0 )
-		CycInt_UpdateInterrupt();
-
-	InterruptHandlers[Handler].type = CYC_INT_CPU;
-	InterruptHandlers[Handler].time = CycleTime;
+	InterruptEvents[Handler].type = CYC_INT_CPU;
+	InterruptEvents[Handler].time = nCyclesMainCounter + CycleTime;
+	InterruptEvents[Handler].key  = InterruptEvents[Handler].time;
+	CycInt_HeapUpdate(Handler);
 
-	/* Set new active int and compute a new value for PendingInterruptCount*/
+	/* Set new active int and compute a new value for PendingInterrupt */
 	CycInt_SetNewInterrupt();
 }
 
@@ -216,14 +385,12 @@ void CycInt_AddRelativeInterruptUs(Sint64 us, interrupt_id Handler) {
     assert(us >= 0);
     
     if(ConfigureParams.System.bRealtime) {
-        /* Update list cycle counts with current PendingInterruptCount before adding a new int, */
-        /* because CycInt_SetNewInterrupt can change the active int / PendingInterruptCount */
-        if ( ActiveInterrupt > 0 ) CycInt_UpdateInterrupt();
-        
-        InterruptHandlers[Handler].type = CYC_INT_US;
-        InterruptHandlers[Handler].time = host_time_us() + us;
-        
-        /* Set new active int and compute a new value for PendingInterruptCount*/
+        InterruptEvents[Handler].type = CYC_INT_US;
+        InterruptEvents[Handler].time = host_time_us() + us;
+        InterruptEvents[Handler].key  = CycInt_UsPollKey(us);
+        CycInt_HeapUpdate(Handler);
+
+        /* Set new active int and compute a new value for PendingInterrupt */
         CycInt_SetNewInterrupt();
     } else {
         CycInt_AddRelativeInterruptCycles(us * ConfigureParams.System.nCpuFreq, Handler);
@@ -235,23 +402,171 @@ void CycInt_AddRelativeInterruptUs(Sint64 us, interrupt_id Handler) {
  * Remove a pending interrupt from our table
  */
 void CycInt_RemovePendingInterrupt(interrupt_id Handler) {
-	/* Update list cycle counts, including the handler we want to remove */
-	/* to be able to resume it later */
-	CycInt_UpdateInterrupt();
-
-	/* Stop interrupt after CycInt_UpdateInterrupt */
-	InterruptHandlers[Handler].type = CYC_INT_NONE;
+	InterruptEvents[Handler].type = CYC_INT_NONE;
+	CycInt_HeapRemove(Handler);
 
 	/* Set new */
 	CycInt_SetNewInterrupt();
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Let the stopped CPU idle until the next event. The calling thread sleeps
+ * in real time for the cycles up to the event, or until another thread
+ * wakes it up. The host clock is only used to key microsecond events.
+ * Returns the number of CPU cycles that passed.
+ */
+Sint64 CycInt_Idle(void) {
+    Sint64 cycles;
+    Sint64 left;
+    Sint64 now = host_time_us();
+    
+    /* While idle, key microsecond events to their full deadline */
+    while (ActiveInterrupt != INTERRUPT_NULL && InterruptEvents[ActiveInterrupt].type == CYC_INT_US) {
+        Sint64 key = nCyclesMainCounter;
+        if (InterruptEvents[ActiveInterrupt].time > now)
+            key += (InterruptEvents[ActiveInterrupt].time - now) * ConfigureParams.System.nCpuFreq;
+        if (key == InterruptEvents[ActiveInterrupt].key)
+            break;
+        InterruptEvents[ActiveInterrupt].key = key;
+        CycInt_HeapDown(InterruptEvents[ActiveInterrupt].pos);
+        CycInt_SetNewInterrupt();
+    }
+    
+    if (PendingInterrupt.pFunction == NULL || PendingInterrupt.time <= 0)
+        return 0;
+    
+    cycles = PendingInterrupt.time;
+    left   = host_sleep_idle_us(cycles / ConfigureParams.System.nCpuFreq);
+    if (left > 0) {
+        /* Woken up early */
+        cycles -= left * ConfigureParams.System.nCpuFreq;
+        if (cycles < 1) cycles = 1;
+    }
+    
+    M68000_AddCycles(cycles);
+    
+    if (left > 0) {
+        /* CPU resumes, go back to polling microsecond events */
+        now = host_time_us();
+        for (int i = INTERRUPT_NULL+1; i < MAX_INTERRUPTS; i++) {
+            if (InterruptEvents[i].type == CYC_INT_US) {
+                InterruptEvents[i].key = CycInt_UsPollKey(InterruptEvents[i].time - now);
+                CycInt_HeapUpdate(i);
+            }
+        }
+        CycInt_SetNewInterrupt();
+    }
+    return cycles;
+}
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Let the stopped CPU skip ahead to the next event in cycle-time mode.
+ * Returns the number of CPU cycles that passed.
+ */
+Sint64 CycInt_Warp(void) {
+    Sint64 cycles = PendingInterrupt.time;
+    
+    if (PendingInterrupt.pFunction == NULL || cycles <= 0)
+        return 0;
+    
+    M68000_AddCycles(cycles);
+    host_warp(cycles);
+    return cycles;
+}
+
 /*-----------------------------------------------------------------------*/
 /**
  * Return true if interrupt is active in list
  */
 bool CycInt_InterruptActive(interrupt_id Handler)
 {
-    return InterruptHandlers[Handler].type != CYC_INT_NONE;
+    return InterruptEvents[Handler].type != CYC_INT_NONE;
+}
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Clear handler statistics
+ */
+void CycInt_ResetStats(void) {
+    memset(IntStats,         0, sizeof(IntStats));
+    memset(IntStatsReported, 0, sizeof(IntStatsReported));
+}
+
+static void CycInt_PrintHist(FILE *fp, const char* label, const Uint64* hist) {
+    int i, last = 0;
+
+    for (i = 0; i < CYCINT_HIST_SIZE; i++)
+        if (hist[i]) last = i;
+    fprintf(fp, "  %-12s", label);
+    for (i = 0; i <= last; i++)
+        fprintf(fp, " %" FMT_ll "u", (unsigned long long)hist[i]);
+    fprintf(fp, "\n");
+}
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Print handler statistics. Histogram bucket 0 counts values <= 0,
+ * bucket n counts values from 2^(n-1) to 2^n-1.
+ */
+void CycInt_Info(FILE *fp) {
+    int i;
+
+    fprintf(fp, "CycInt handler statistics (histogram buckets: <=0, 1, 2-3, 4-7, ...):\n");
+    for (i = INTERRUPT_NULL+1; i < MAX_INTERRUPTS; i++) {
+        CYCINT_STATS* stats = &IntStats[i];
+        if (stats->fired == 0)
+            continue;
+        fprintf(fp, "%s: fired=%" FMT_ll "u maxLate=%" FMT_ll "d cycles/%" FMT_ll "dus cost avg=%" FMT_ll "uus max=%" FMT_ll "uus\n",
+                IntNames[i], (unsigned long long)stats->fired,
+                (long long)stats->maxLateCycles, (long long)stats->maxLateUs,
+                (unsigned long long)(stats->timed ? CycInt_TicksToUs(stats->totalCostTicks) / stats->timed : 0),
+                (unsigned long long)CycInt_TicksToUs(stats->maxCostTicks));
+        CycInt_PrintHist(fp, "late cycles", stats->lateCycles);
+        CycInt_PrintHist(fp, "late us",     stats->lateUs);
+        CycInt_PrintHist(fp, "cost us",     stats->costUs);
+    }
+}
+
+static char report[2048];
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Report handler calls since the last report. For every handler the
+ * lateness histogram in microseconds is printed as [<=0,1,2-3,...].
+ */
+const char* CycInt_Report(double realTime, double hostTime) {
+    char* r   = report;
+    char* end = report + sizeof(report);
+    int   i, j, last;
+
+    report[0] = 0;
+    for (i = INTERRUPT_NULL+1; i < MAX_INTERRUPTS && end - r > 64; i++) {
+        CYCINT_STATS* stats = &IntStats[i];
+        CYCINT_STATS* prev  = &IntStatsReported[i];
+        Uint64        lateUs[CYCINT_HIST_SIZE];
+        Uint64        cost;
+
+        if (stats->fired == prev->fired)
+            continue;
+        last = 0;
+        for (j = 0; j < CYCINT_HIST_SIZE; j++) {
+            lateUs[j] = stats->lateUs[j] - prev->lateUs[j];
+            if (lateUs[j]) last = j;
+        }
+        r += snprintf(r, end - r, " %s:%" FMT_ll "u[", IntNames[i],
+                      (unsigned long long)(stats->fired - prev->fired));
+        for (j = 0; j <= last && end - r > 64; j++)
+            r += snprintf(r, end - r, j ? ",%" FMT_ll "u" : "%" FMT_ll "u", (unsigned long long)lateUs[j]);
+        /* scale the sampled handler cost up to all calls */
+        cost = stats->totalCostTicks - prev->totalCostTicks;
+        if (stats->timed != prev->timed)
+            cost = cost * (stats->fired - prev->fired) / (stats->timed - prev->timed);
+        r += snprintf(r, end - r, "]us %" FMT_ll "uus",
+                      (unsigned long long)CycInt_TicksToUs(cost));
+        *prev = *stats;
+    }
+    return report;
 }
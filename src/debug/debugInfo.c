@@ -14,6 +14,7 @@ const char DebugInfo_fileid[] = "Hatari debuginfo.c : " __DATE__ " " __TIME__;
 #include <ctype.h>
 #include "main.h"
 #include "configuration.h"
+#include "cycInt.h"
 #include "debugInfo.h"
 #include "debugcpu.h"
 #include "debugui.h"
@@ -39,6 +40,30 @@ static void DebugInfo_Rtc(Uint32 dummy) {
 	fprintf(stdout,"%s",get_rtc_ram_info());
 }
 
+/**
+ * DebugInfo_CycInt : display event handler statistics.
+ */
+static void DebugInfo_CycInt(Uint32 mode) {
+	if (mode == 2) {
+		CycInt_ResetStats();
+		fprintf(stderr, "CycInt handler statistics cleared.\n");
+		return;
+	}
+	CycInt_Info(stderr);
+}
+
+/**
+ * Parse optional "reset" argument for "cycint" info.
+ * Return 1 to show, 2 to clear statistics and 0 on error.
+ */
+static Uint32 DebugInfo_CycIntArgs(int argc, char *argv[]) {
+	if (argc == 0)
+		return 1;
+	if (argc == 1 && strcmp(argv[0], "reset") == 0)
+		return 2;
+	return 0;
+}
+
 /* ------------------------------------------------------------------
  * CPU and DSP information wrappers
  */
@@ -215,6 +240,7 @@ static const struct {
 	Uint32 (*args)(int argc, char *argv[]);
 	const char *info;
 } infotable[] = {
+	{ false,"cycint",    DebugInfo_CycInt,     DebugInfo_CycIntArgs, "Show event handler lateness and cost, [reset] clears them" },
 	{ true, "default",   DebugInfo_Default,    NULL, "Show default debugger entry information" },
 	{ true, "disasm",    DebugInfo_CpuDisAsm,  NULL, "Disasm CPU from PC or given <address>" },
 #if ENABLE_DSP_EMU
@@ -229,7 +255,7 @@ static const struct {
 	{ false,"rtc",     DebugInfo_Rtc,      NULL, "Show Next's RTC registers" }
 };
 
-static int LockedFunction = 4; /* index for the "default" function */
+static int LockedFunction = 5; /* index for the "default" function */
 static Uint32 LockedArgument;
 
 /**
@@ -141,9 +141,11 @@ void   nd_board_wr128_le(Uint32 addr, const Uint32* val) {
     nd_longput(addr+12, val[3]);
 }
 
-/* NeXTdimension board memory access (m68k) */
+/* NeXTdimension board memory access (m68k)
+ * The i860 is brought up to date before every access from the m68k. */
 
 inline Uint32 nd_board_lget(Uint32 addr) {
+    M68000_SyncCoprocessors();
     addr |= ND_BOARD_BITS;
     Uint32 result = nd_longget(addr);
     // (SC) delay m68k read on csr0 while in ROM (CS8=1)to give ND some time to start up.
@@ -153,26 +155,31 @@ inline Uint32 nd_board_lget(Uint32 addr) {
 }
 
 inline Uint16 nd_board_wget(Uint32 addr) {
+    M68000_SyncCoprocessors();
     addr |= ND_BOARD_BITS;
     return nd_wordget(addr);
 }
 
 inline Uint8 nd_board_bget(Uint32 addr) {
+    M68000_SyncCoprocessors();
     addr |= ND_BOARD_BITS;
     return nd_byteget(addr);
 }
 
 inline void nd_board_lput(Uint32 addr, Uint32 l) {
+    M68000_SyncCoprocessors();
     addr |= ND_BOARD_BITS;
     nd_longput(addr, l);
 }
 
 inline void nd_board_wput(Uint32 addr, Uint16 w) {
+    M68000_SyncCoprocessors();
     addr |= ND_BOARD_BITS;
     nd_wordput(addr, w);
 }
 
 inline void nd_board_bput(Uint32 addr, Uint8 b) {
+    M68000_SyncCoprocessors();
     addr |= ND_BOARD_BITS;
     nd_byteput(addr, b);
 }
@@ -184,6 +191,7 @@ inline Uint8 nd_board_cs8get(Uint32 addr) {
 
 /* NeXTdimension slot memory access */
 Uint32 nd_slot_lget(Uint32 addr) {
+    M68000_SyncCoprocessors();
     addr |= ND_SLOT_BITS;
     
     if (addr<ND_NBIC_SPACE) {
@@ -194,6 +202,7 @@ Uint32 nd_slot_lget(Uint32 addr) {
 }
 
 Uint16 nd_slot_wget(Uint32 addr) {
+    M68000_SyncCoprocessors();
     addr |= ND_SLOT_BITS;
     
     if (addr<ND_NBIC_SPACE) {
@@ -204,6 +213,7 @@ Uint16 nd_slot_wget(Uint32 addr) {
 }
 
 Uint8 nd_slot_bget(Uint32 addr) {
+    M68000_SyncCoprocessors();
     addr |= ND_SLOT_BITS;
     
     if (addr<ND_NBIC_SPACE) {
@@ -214,6 +224,7 @@ Uint8 nd_slot_bget(Uint32 addr) {
 }
 
 void nd_slot_lput(Uint32 addr, Uint32 l) {
+    M68000_SyncCoprocessors();
     addr |= ND_SLOT_BITS;
     
     if (addr<ND_NBIC_SPACE) {
@@ -224,6 +235,7 @@ void nd_slot_lput(Uint32 addr, Uint32 l) {
 }
 
 void nd_slot_wput(Uint32 addr, Uint16 w) {
+    M68000_SyncCoprocessors();
     addr |= ND_SLOT_BITS;
     
     if (addr<ND_NBIC_SPACE) {
@@ -234,6 +246,7 @@ void nd_slot_wput(Uint32 addr, Uint16 w) {
 }
 
 void nd_slot_bput(Uint32 addr, Uint8 b) {
+    M68000_SyncCoprocessors();
     addr |= ND_SLOT_BITS;
     
     if (addr<ND_NBIC_SPACE) {
@@ -66,6 +66,7 @@ extern "C" {
     
     int i860_thread(void* data) {
         SDL_SetThreadPriority(SDL_THREAD_PRIORITY_LOW);
+        host_thread_setup(THREAD_I860);
         ((i860_cpu_device*)data)->run();
         return 0;
     }
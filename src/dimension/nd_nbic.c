@@ -213,6 +213,7 @@ void nd_nbic_bput(Uint32 addr, Uint8 b) {
 void nd_nbic_set_intstatus(bool set) {
 	if (set) {
         nd_nbic.intstatus |= ND_NBIC_INTR;
+        host_wake(); /* wake up 68k if it sleeps in STOP */
 	} else {
         nd_nbic.intstatus &= ~ND_NBIC_INTR;
 	}
@@ -20,6 +20,7 @@ void blitDimension(SDL_Texture* tex);
 
 static int repainter(void* unused) {
     SDL_SetThreadPriority(SDL_THREAD_PRIORITY_NORMAL);
+    host_thread_setup(THREAD_RENDER);
     
     SDL_Texture*  ndTexture  = NULL;
     
@@ -161,20 +161,23 @@ int get_interrupt_type(int channel) {
     }
 }
 
-void DMA_CSR_Read(void) { // 0x02000010, length of register is byte on 68030 based NeXT Computer
-    int channel = get_channel(IoAccessCurrentAddress);
+Uint32 DMA_CSR_ReadLong(Uint32 addr) { // 0x02000010, length of register is byte on 68030 based NeXT Computer
+    int channel = get_channel(addr);
     
-    IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = dma[channel].csr;
-    IoMem[(IoAccessCurrentAddress+1) & IO_SEG_MASK] = IoMem[(IoAccessCurrentAddress+2) & IO_SEG_MASK] = IoMem[(IoAccessCurrentAddress+3) & IO_SEG_MASK] = 0x00; // just to be sure
-    Log_Printf(LOG_DMA_LEVEL,"DMA CSR read at $%08x val=$%02x PC=$%08x\n", IoAccessCurrentAddress, dma[channel].csr, m68k_getpc());
+    Log_Printf(LOG_DMA_LEVEL,"DMA CSR read at $%08x val=$%02x PC=$%08x\n", addr, dma[channel].csr, m68k_getpc());
+    return dma[channel].csr<<24; // lower bytes are zero, just to be sure
 }
 
-void DMA_CSR_Write(void) {
-    int channel = get_channel(IoAccessCurrentAddress);
+void DMA_CSR_Read(void) {
+    IoMem_WriteLong(IoAccessCurrentAddress & IO_SEG_MASK, DMA_CSR_ReadLong(IoAccessCurrentAddress));
+}
+
+void DMA_CSR_WriteLong(Uint32 addr, Uint32 val) {
+    int channel = get_channel(addr);
     int interrupt = get_interrupt_type(channel);
-    Uint8 writecsr = IoMem[IoAccessCurrentAddress & IO_SEG_MASK]|IoMem[(IoAccessCurrentAddress+1) & IO_SEG_MASK]|IoMem[(IoAccessCurrentAddress+2) & IO_SEG_MASK]|IoMem[(IoAccessCurrentAddress+3) & IO_SEG_MASK];
+    Uint8 writecsr = (val>>24)|(val>>16)|(val>>8)|val;
 
-    Log_Printf(LOG_DMA_LEVEL,"DMA CSR write at $%08x val=$%02x PC=$%08x\n", IoAccessCurrentAddress, writecsr, m68k_getpc());
+    Log_Printf(LOG_DMA_LEVEL,"DMA CSR write at $%08x val=$%02x PC=$%08x\n", addr, writecsr, m68k_getpc());
     
     /* For debugging */
     if(writecsr&DMA_DEV2M)
@@ -241,113 +244,189 @@ void DMA_CSR_Write(void) {
     set_interrupt(interrupt, RELEASE_INT); // experimental
 }
 
-void DMA_Saved_Next_Read(void) { // 0x02004000
-    int channel = get_channel(IoAccessCurrentAddress-0x3FF0);
-    IoMem_WriteLong(IoAccessCurrentAddress & IO_SEG_MASK, dma[channel].saved_next);
- 	Log_Printf(LOG_DMA_LEVEL,"DMA SNext read at $%08x val=$%08x PC=$%08x\n", IoAccessCurrentAddress, dma[channel].saved_next, m68k_getpc());
+void DMA_CSR_Write(void) {
+    DMA_CSR_WriteLong(IoAccessCurrentAddress, IoMem_ReadLong(IoAccessCurrentAddress & IO_SEG_MASK));
+}
+
+Uint32 DMA_Saved_Next_ReadLong(Uint32 addr) { // 0x02004000
+    int channel = get_channel(addr-0x3FF0);
+ 	Log_Printf(LOG_DMA_LEVEL,"DMA SNext read at $%08x val=$%08x PC=$%08x\n", addr, dma[channel].saved_next, m68k_getpc());
+    return dma[channel].saved_next;
+}
+
+void DMA_Saved_Next_Read(void) {
+    IoMem_WriteLong(IoAccessCurrentAddress & IO_SEG_MASK, DMA_Saved_Next_ReadLong(IoAccessCurrentAddress));
+}
+
+void DMA_Saved_Next_WriteLong(Uint32 addr, Uint32 val) {
+    int channel = get_channel(addr-0x3FF0);
+    dma[channel].saved_next = val;
+    Log_Printf(LOG_DMA_LEVEL,"DMA SNext write at $%08x val=$%08x PC=$%08x\n", addr, dma[channel].saved_next, m68k_getpc());
 }
 
 void DMA_Saved_Next_Write(void) {
-    int channel = get_channel(IoAccessCurrentAddress-0x3FF0);
-    dma[channel].saved_next = IoMem_ReadLong(IoAccessCurrentAddress & IO_SEG_MASK);
-    Log_Printf(LOG_DMA_LEVEL,"DMA SNext write at $%08x val=$%08x PC=$%08x\n", IoAccessCurrentAddress, dma[channel].saved_next, m68k_getpc());
+    DMA_Saved_Next_WriteLong(IoAccessCurrentAddress, IoMem_ReadLong(IoAccessCurrentAddress & IO_SEG_MASK));
+}
+
+Uint32 DMA_Saved_Limit_ReadLong(Uint32 addr) { // 0x02004004
+    int channel = get_channel(addr-0x3FF4);
+ 	Log_Printf(LOG_DMA_LEVEL,"DMA SLimit read at $%08x val=$%08x PC=$%08x\n", addr, dma[channel].saved_limit, m68k_getpc());
+    return dma[channel].saved_limit;
+}
+
+void DMA_Saved_Limit_Read(void) {
+    IoMem_WriteLong(IoAccessCurrentAddress & IO_SEG_MASK, DMA_Saved_Limit_ReadLong(IoAccessCurrentAddress));
 }
 
-void DMA_Saved_Limit_Read(void) { // 0x02004004
-    int channel = get_channel(IoAccessCurrentAddress-0x3FF4);
-    IoMem_WriteLong(IoAccessCurrentAddress & IO_SEG_MASK, dma[channel].saved_limit);
- 	Log_Printf(LOG_DMA_LEVEL,"DMA SLimit read at $%08x val=$%08x PC=$%08x\n", IoAccessCurrentAddress, dma[channel].saved_limit, m68k_getpc());
+void DMA_Saved_Limit_WriteLong(Uint32 addr, Uint32 val) {
+    int channel = get_channel(addr-0x3FF4);
+    dma[channel].saved_limit = val;
+    Log_Printf(LOG_DMA_LEVEL,"DMA SLimit write at $%08x val=$%08x PC=$%08x\n", addr, dma[channel].saved_limit, m68k_getpc());
 }
 
 void DMA_Saved_Limit_Write(void) {
-    int channel = get_channel(IoAccessCurrentAddress-0x3FF4);
-    dma[channel].saved_limit = IoMem_ReadLong(IoAccessCurrentAddress & IO_SEG_MASK);
-    Log_Printf(LOG_DMA_LEVEL,"DMA SLimit write at $%08x val=$%08x PC=$%08x\n", IoAccessCurrentAddress, dma[channel].saved_limit, m68k_getpc());
+    DMA_Saved_Limit_WriteLong(IoAccessCurrentAddress, IoMem_ReadLong(IoAccessCurrentAddress & IO_SEG_MASK));
 }
 
-void DMA_Saved_Start_Read(void) { // 0x02004008
-    int channel = get_channel(IoAccessCurrentAddress-0x3FF8);
-    IoMem_WriteLong(IoAccessCurrentAddress & IO_SEG_MASK, dma[channel].saved_start);
- 	Log_Printf(LOG_DMA_LEVEL,"DMA SStart read at $%08x val=$%08x PC=$%08x\n", IoAccessCurrentAddress, dma[channel].saved_start, m68k_getpc());
+Uint32 DMA_Saved_Start_ReadLong(Uint32 addr) { // 0x02004008
+    int channel = get_channel(addr-0x3FF8);
+ 	Log_Printf(LOG_DMA_LEVEL,"DMA SStart read at $%08x val=$%08x PC=$%08x\n", addr, dma[channel].saved_start, m68k_getpc());
+    return dma[channel].saved_start;
+}
+
+void DMA_Saved_Start_Read(void) {
+    IoMem_WriteLong(IoAccessCurrentAddress & IO_SEG_MASK, DMA_Saved_Start_ReadLong(IoAccessCurrentAddress));
+}
+
+void DMA_Saved_Start_WriteLong(Uint32 addr, Uint32 val) {
+    int channel = get_channel(addr-0x3FF8);
+    dma[channel].saved_start = val;
+    Log_Printf(LOG_DMA_LEVEL,"DMA SStart write at $%08x val=$%08x PC=$%08x\n", addr, dma[channel].saved_start, m68k_getpc());
 }
 
 void DMA_Saved_Start_Write(void) {
-    int channel = get_channel(IoAccessCurrentAddress-0x3FF8);
-    dma[channel].saved_start = IoMem_ReadLong(IoAccessCurrentAddress & IO_SEG_MASK);
-    Log_Printf(LOG_DMA_LEVEL,"DMA SStart write at $%08x val=$%08x PC=$%08x\n", IoAccessCurrentAddress, dma[channel].saved_start, m68k_getpc());
+    DMA_Saved_Start_WriteLong(IoAccessCurrentAddress, IoMem_ReadLong(IoAccessCurrentAddress & IO_SEG_MASK));
+}
+
+Uint32 DMA_Saved_Stop_ReadLong(Uint32 addr) { // 0x0200400c
+    int channel = get_channel(addr-0x3FFC);
+ 	Log_Printf(LOG_DMA_LEVEL,"DMA SStop read at $%08x val=$%08x PC=$%08x\n", addr, dma[channel].saved_stop, m68k_getpc());
+    return dma[channel].saved_stop;
+}
+
+void DMA_Saved_Stop_Read(void) {
+    IoMem_WriteLong(IoAccessCurrentAddress & IO_SEG_MASK, DMA_Saved_Stop_ReadLong(IoAccessCurrentAddress));
 }
 
-void DMA_Saved_Stop_Read(void) { // 0x0200400c
-    int channel = get_channel(IoAccessCurrentAddress-0x3FFC);
-    IoMem_WriteLong(IoAccessCurrentAddress & IO_SEG_MASK, dma[channel].saved_stop);
- 	Log_Printf(LOG_DMA_LEVEL,"DMA SStop read at $%08x val=$%08x PC=$%08x\n", IoAccessCurrentAddress, dma[channel].saved_stop, m68k_getpc());
+void DMA_Saved_Stop_WriteLong(Uint32 addr, Uint32 val) {
+    int channel = get_channel(addr-0x3FFC);
+    dma[channel].saved_stop = val;
+    Log_Printf(LOG_DMA_LEVEL,"DMA SStop write at $%08x val=$%08x PC=$%08x\n", addr, dma[channel].saved_stop, m68k_getpc());
 }
 
 void DMA_Saved_Stop_Write(void) {
-    int channel = get_channel(IoAccessCurrentAddress-0x3FFC);
-    dma[channel].saved_stop = IoMem_ReadLong(IoAccessCurrentAddress & IO_SEG_MASK);
-    Log_Printf(LOG_DMA_LEVEL,"DMA SStop write at $%08x val=$%08x PC=$%08x\n", IoAccessCurrentAddress, dma[channel].saved_stop, m68k_getpc());
+    DMA_Saved_Stop_WriteLong(IoAccessCurrentAddress, IoMem_ReadLong(IoAccessCurrentAddress & IO_SEG_MASK));
 }
 
-void DMA_Next_Read(void) { // 0x02004010
-    int channel = get_channel(IoAccessCurrentAddress-0x4000);
-    IoMem_WriteLong(IoAccessCurrentAddress & IO_SEG_MASK, dma[channel].next);
- 	Log_Printf(LOG_DMA_LEVEL,"DMA Next read at $%08x val=$%08x PC=$%08x\n", IoAccessCurrentAddress, dma[channel].next, m68k_getpc());
+Uint32 DMA_Next_ReadLong(Uint32 addr) { // 0x02004010
+    int channel = get_channel(addr-0x4000);
+ 	Log_Printf(LOG_DMA_LEVEL,"DMA Next read at $%08x val=$%08x PC=$%08x\n", addr, dma[channel].next, m68k_getpc());
+    return dma[channel].next;
+}
+
+void DMA_Next_Read(void) {
+    IoMem_WriteLong(IoAccessCurrentAddress & IO_SEG_MASK, DMA_Next_ReadLong(IoAccessCurrentAddress));
+}
+
+void DMA_Next_WriteLong(Uint32 addr, Uint32 val) {
+    int channel = get_channel(addr-0x4000);
+    dma[channel].next = val;
+    Log_Printf(LOG_DMA_LEVEL,"DMA Next write at $%08x val=$%08x PC=$%08x\n", addr, dma[channel].next, m68k_getpc());
 }
 
 void DMA_Next_Write(void) {
-    int channel = get_channel(IoAccessCurrentAddress-0x4000);
-    dma[channel].next = IoMem_ReadLong(IoAccessCurrentAddress & IO_SEG_MASK);
-    Log_Printf(LOG_DMA_LEVEL,"DMA Next write at $%08x val=$%08x PC=$%08x\n", IoAccessCurrentAddress, dma[channel].next, m68k_getpc());
+    DMA_Next_WriteLong(IoAccessCurrentAddress, IoMem_ReadLong(IoAccessCurrentAddress & IO_SEG_MASK));
+}
+
+Uint32 DMA_Limit_ReadLong(Uint32 addr) { // 0x02004014
+    int channel = get_channel(addr-0x4004);
+ 	Log_Printf(LOG_DMA_LEVEL,"DMA Limit read at $%08x val=$%08x PC=$%08x\n", addr, dma[channel].limit, m68k_getpc());
+    return dma[channel].limit;
 }
 
-void DMA_Limit_Read(void) { // 0x02004014
-    int channel = get_channel(IoAccessCurrentAddress-0x4004);
-    IoMem_WriteLong(IoAccessCurrentAddress & IO_SEG_MASK, dma[channel].limit);
- 	Log_Printf(LOG_DMA_LEVEL,"DMA Limit read at $%08x val=$%08x PC=$%08x\n", IoAccessCurrentAddress, dma[channel].limit, m68k_getpc());
+void DMA_Limit_Read(void) {
+    IoMem_WriteLong(IoAccessCurrentAddress & IO_SEG_MASK, DMA_Limit_ReadLong(IoAccessCurrentAddress));
+}
+
+void DMA_Limit_WriteLong(Uint32 addr, Uint32 val) {
+    int channel = get_channel(addr-0x4004);
+    dma[channel].limit = val;
+    Log_Printf(LOG_DMA_LEVEL,"DMA Limit write at $%08x val=$%08x PC=$%08x\n", addr, dma[channel].limit, m68k_getpc());
 }
 
 void DMA_Limit_Write(void) {
-    int channel = get_channel(IoAccessCurrentAddress-0x4004);
-    dma[channel].limit = IoMem_ReadLong(IoAccessCurrentAddress & IO_SEG_MASK);
-    Log_Printf(LOG_DMA_LEVEL,"DMA Limit write at $%08x val=$%08x PC=$%08x\n", IoAccessCurrentAddress, dma[channel].limit, m68k_getpc());
+    DMA_Limit_WriteLong(IoAccessCurrentAddress, IoMem_ReadLong(IoAccessCurrentAddress & IO_SEG_MASK));
+}
+
+Uint32 DMA_Start_ReadLong(Uint32 addr) { // 0x02004018
+    int channel = get_channel(addr-0x4008);
+ 	Log_Printf(LOG_DMA_LEVEL,"DMA Start read at $%08x val=$%08x PC=$%08x\n", addr, dma[channel].start, m68k_getpc());
+    return dma[channel].start;
+}
+
+void DMA_Start_Read(void) {
+    IoMem_WriteLong(IoAccessCurrentAddress & IO_SEG_MASK, DMA_Start_ReadLong(IoAccessCurrentAddress));
 }
 
-void DMA_Start_Read(void) { // 0x02004018
-    int channel = get_channel(IoAccessCurrentAddress-0x4008);
-    IoMem_WriteLong(IoAccessCurrentAddress & IO_SEG_MASK, dma[channel].start);
- 	Log_Printf(LOG_DMA_LEVEL,"DMA Start read at $%08x val=$%08x PC=$%08x\n", IoAccessCurrentAddress, dma[channel].start, m68k_getpc());
+void DMA_Start_WriteLong(Uint32 addr, Uint32 val) {
+    int channel = get_channel(addr-0x4008);
+    dma[channel].start = val;
+    Log_Printf(LOG_DMA_LEVEL,"DMA Start write at $%08x val=$%08x PC=$%08x\n", addr, dma[channel].start, m68k_getpc());
 }
 
 void DMA_Start_Write(void) {
-    int channel = get_channel(IoAccessCurrentAddress-0x4008);
-    dma[channel].start = IoMem_ReadLong(IoAccessCurrentAddress & IO_SEG_MASK);
-    Log_Printf(LOG_DMA_LEVEL,"DMA Start write at $%08x val=$%08x PC=$%08x\n", IoAccessCurrentAddress, dma[channel].start, m68k_getpc());
+    DMA_Start_WriteLong(IoAccessCurrentAddress, IoMem_ReadLong(IoAccessCurrentAddress & IO_SEG_MASK));
+}
+
+Uint32 DMA_Stop_ReadLong(Uint32 addr) { // 0x0200401c
+    int channel = get_channel(addr-0x400C);
+ 	Log_Printf(LOG_DMA_LEVEL,"DMA Stop read at $%08x val=$%08x PC=$%08x\n", addr, dma[channel].stop, m68k_getpc());
+    return dma[channel].stop;
 }
 
-void DMA_Stop_Read(void) { // 0x0200401c
-    int channel = get_channel(IoAccessCurrentAddress-0x400C);
-    IoMem_WriteLong(IoAccessCurrentAddress & IO_SEG_MASK, dma[channel].stop);
- 	Log_Printf(LOG_DMA_LEVEL,"DMA Stop read at $%08x val=$%08x PC=$%08x\n", IoAccessCurrentAddress, dma[channel].stop, m68k_getpc());
+void DMA_Stop_Read(void) {
+    IoMem_WriteLong(IoAccessCurrentAddress & IO_SEG_MASK, DMA_Stop_ReadLong(IoAccessCurrentAddress));
+}
+
+void DMA_Stop_WriteLong(Uint32 addr, Uint32 val) {
+    int channel = get_channel(addr-0x400C);
+    dma[channel].stop = val;
+    Log_Printf(LOG_DMA_LEVEL,"DMA Stop write at $%08x val=$%08x PC=$%08x\n", addr, dma[channel].stop, m68k_getpc());
 }
 
 void DMA_Stop_Write(void) {
-    int channel = get_channel(IoAccessCurrentAddress-0x400C);
-    dma[channel].stop = IoMem_ReadLong(IoAccessCurrentAddress & IO_SEG_MASK);
-    Log_Printf(LOG_DMA_LEVEL,"DMA Stop write at $%08x val=$%08x PC=$%08x\n", IoAccessCurrentAddress, dma[channel].stop, m68k_getpc());
+    DMA_Stop_WriteLong(IoAccessCurrentAddress, IoMem_ReadLong(IoAccessCurrentAddress & IO_SEG_MASK));
 }
 
-void DMA_Init_Read(void) { // 0x02004210
-    int channel = get_channel(IoAccessCurrentAddress-0x4200);
-    IoMem_WriteLong(IoAccessCurrentAddress & IO_SEG_MASK, dma[channel].next);
- 	Log_Printf(LOG_DMA_LEVEL,"DMA Init read at $%08x val=$%08x PC=$%08x\n", IoAccessCurrentAddress, dma[channel].next, m68k_getpc());
+Uint32 DMA_Init_ReadLong(Uint32 addr) { // 0x02004210
+    int channel = get_channel(addr-0x4200);
+ 	Log_Printf(LOG_DMA_LEVEL,"DMA Init read at $%08x val=$%08x PC=$%08x\n", addr, dma[channel].next, m68k_getpc());
+    return dma[channel].next;
 }
 
-void DMA_Init_Write(void) {
-    int channel = get_channel(IoAccessCurrentAddress-0x4200);
-    dma[channel].next = IoMem_ReadLong(IoAccessCurrentAddress & IO_SEG_MASK);
+void DMA_Init_Read(void) {
+    IoMem_WriteLong(IoAccessCurrentAddress & IO_SEG_MASK, DMA_Init_ReadLong(IoAccessCurrentAddress));
+}
+
+void DMA_Init_WriteLong(Uint32 addr, Uint32 val) {
+    int channel = get_channel(addr-0x4200);
+    dma[channel].next = val;
     dma_initialize_buffer(channel, dma[channel].next&0xF);
-    Log_Printf(LOG_DMA_LEVEL,"DMA Init write at $%08x val=$%08x PC=$%08x\n", IoAccessCurrentAddress, dma[channel].next, m68k_getpc());
+    Log_Printf(LOG_DMA_LEVEL,"DMA Init write at $%08x val=$%08x PC=$%08x\n", addr, dma[channel].next, m68k_getpc());
+}
+
+void DMA_Init_Write(void) {
+    DMA_Init_WriteLong(IoAccessCurrentAddress, IoMem_ReadLong(IoAccessCurrentAddress & IO_SEG_MASK));
 }
 
 /* Initialize DMA internal buffer */
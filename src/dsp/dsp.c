@@ -853,6 +853,8 @@ void DSP_HandleReadAccess(void)
 	Uint8 value;
 	bool multi_access = false; 
 	
+	M68000_SyncCoprocessors();
+
 	for (addr = IoAccessBaseAddress; addr < IoAccessBaseAddress+nIoMemAccessSize; addr++)
 	{
 #if ENABLE_DSP_EMU
@@ -880,6 +882,8 @@ void DSP_HandleWriteAccess(void)
 	Uint32 addr;
 	bool multi_access = false; 
 
+	M68000_SyncCoprocessors();
+
 	for (addr = IoAccessBaseAddress; addr < IoAccessBaseAddress+nIoMemAccessSize; addr++)
 	{
 #if ENABLE_DSP_EMU
@@ -923,6 +927,7 @@ void DSP_HandleWriteAccess(void)
 
 
 void DSP_ICR_Read(void) { // 0x02008000
+    M68000_SyncCoprocessors();
 #if ENABLE_DSP_EMU
 	if (bDspEmulated)
 		IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = dsp_core_read_host(CPU_HOST_ICR);
@@ -935,6 +940,7 @@ void DSP_ICR_Read(void) { // 0x02008000
 }
 
 void DSP_ICR_Write(void) {
+    M68000_SyncCoprocessors();
 #if ENABLE_DSP_EMU
 	if (bDspEmulated)
 		dsp_core_write_host(CPU_HOST_ICR, IoMem[IoAccessCurrentAddress & IO_SEG_MASK]);
@@ -943,6 +949,7 @@ void DSP_ICR_Write(void) {
 }
 
 void DSP_CVR_Read(void) { // 0x02008001
+    M68000_SyncCoprocessors();
 #if ENABLE_DSP_EMU
 	if (bDspEmulated)
 		IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = dsp_core_read_host(CPU_HOST_CVR);
@@ -955,6 +962,7 @@ void DSP_CVR_Read(void) { // 0x02008001
 }
 
 void DSP_CVR_Write(void) {
+    M68000_SyncCoprocessors();
 #if ENABLE_DSP_EMU
 	if (bDspEmulated)
 		dsp_core_write_host(CPU_HOST_CVR, IoMem[IoAccessCurrentAddress & IO_SEG_MASK]);
@@ -963,6 +971,7 @@ void DSP_CVR_Write(void) {
 }
 
 void DSP_ISR_Read(void) { // 0x02008002
+    M68000_SyncCoprocessors();
 #if ENABLE_DSP_EMU
 	if (bDspEmulated)
 		IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = dsp_core_read_host(CPU_HOST_ISR);
@@ -975,6 +984,7 @@ void DSP_ISR_Read(void) { // 0x02008002
 }
 
 void DSP_ISR_Write(void) {
+    M68000_SyncCoprocessors();
 #if ENABLE_DSP_EMU
 	if (bDspEmulated)
 		dsp_core_write_host(CPU_HOST_ISR, IoMem[IoAccessCurrentAddress & IO_SEG_MASK]);
@@ -983,6 +993,7 @@ void DSP_ISR_Write(void) {
 }
 
 void DSP_IVR_Read(void) { // 0x02008003
+    M68000_SyncCoprocessors();
 #if ENABLE_DSP_EMU
 	if (bDspEmulated)
 		IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = dsp_core_read_host(CPU_HOST_IVR);
@@ -995,6 +1006,7 @@ void DSP_IVR_Read(void) { // 0x02008003
 }
 
 void DSP_IVR_Write(void) {
+    M68000_SyncCoprocessors();
 #if ENABLE_DSP_EMU
 	if (bDspEmulated)
 		dsp_core_write_host(CPU_HOST_IVR, IoMem[IoAccessCurrentAddress & IO_SEG_MASK]);
@@ -1003,6 +1015,7 @@ void DSP_IVR_Write(void) {
 }
 
 void DSP_Data0_Read(void) { // 0x02008004
+    M68000_SyncCoprocessors();
 #if ENABLE_DSP_EMU
 	if (bDspEmulated)
 		IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = dsp_core_read_host(CPU_HOST_TRX0);
@@ -1015,6 +1028,7 @@ void DSP_Data0_Read(void) { // 0x02008004
 }
 
 void DSP_Data0_Write(void) {
+    M68000_SyncCoprocessors();
 #if ENABLE_DSP_EMU
 	if (bDspEmulated)
 		dsp_core_write_host(CPU_HOST_TRX0, IoMem[IoAccessCurrentAddress & IO_SEG_MASK]);
@@ -1023,6 +1037,7 @@ void DSP_Data0_Write(void) {
 }
 
 void DSP_Data1_Read(void) { // 0x02008005
+    M68000_SyncCoprocessors();
 #if ENABLE_DSP_EMU
 	if (bDspEmulated)
 		IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = dsp_core_read_host(CPU_HOST_TRXH);
@@ -1035,6 +1050,7 @@ void DSP_Data1_Read(void) { // 0x02008005
 }
 
 void DSP_Data1_Write(void) {
+    M68000_SyncCoprocessors();
 #if ENABLE_DSP_EMU
 	if (bDspEmulated)
 		dsp_core_write_host(CPU_HOST_TRXH, IoMem[IoAccessCurrentAddress & IO_SEG_MASK]);
@@ -1043,6 +1059,7 @@ void DSP_Data1_Write(void) {
 }
 
 void DSP_Data2_Read(void) { // 0x02008006
+    M68000_SyncCoprocessors();
 #if ENABLE_DSP_EMU
 	if (bDspEmulated)
 		IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = dsp_core_read_host(CPU_HOST_TRXM);
@@ -1055,6 +1072,7 @@ void DSP_Data2_Read(void) { // 0x02008006
 }
 
 void DSP_Data2_Write(void) {
+    M68000_SyncCoprocessors();
 #if ENABLE_DSP_EMU
 	if (bDspEmulated)
 		dsp_core_write_host(CPU_HOST_TRXM, IoMem[IoAccessCurrentAddress & IO_SEG_MASK]);
@@ -1063,6 +1081,7 @@ void DSP_Data2_Write(void) {
 }
 
 void DSP_Data3_Read(void) { // 0x02008007
+    M68000_SyncCoprocessors();
 #if ENABLE_DSP_EMU
 	if (bDspEmulated)
 		IoMem[IoAccessCurrentAddress & IO_SEG_MASK] = dsp_core_read_host(CPU_HOST_TRXL);
@@ -1075,6 +1094,7 @@ void DSP_Data3_Read(void) { // 0x02008007
 }
 
 void DSP_Data3_Write(void) {
+    M68000_SyncCoprocessors();
 #if ENABLE_DSP_EMU
 	if (bDspEmulated)
 		dsp_core_write_host(CPU_HOST_TRXL, IoMem[IoAccessCurrentAddress & IO_SEG_MASK]);
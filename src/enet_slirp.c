@@ -3,6 +3,7 @@
 #include "enet_slirp.h"
 #include "queue.h"
 #include "host.h"
+#include "configuration.h"
 
 #ifndef _WIN32
 #include <signal.h>
@@ -91,6 +92,7 @@ static void slirp_tick(void)
 
 static int tick_func(void *arg)
 {
+    host_thread_setup(THREAD_SLIRP);
     while(slirp_inited)
     {
         host_sleep_ms(10);
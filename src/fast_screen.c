@@ -23,6 +23,7 @@ const char Screen_fileid[] = "Previous fast_screen.c : " __DATE__ " " __TIME__;
 #include "control.h"
 #include "statusbar.h"
 #include "video.h"
+#include "host.h"
 
 SDL_Window*   sdlWindow;
 SDL_Surface*  sdlscrn = NULL;   /* The SDL screen surface */
@@ -47,6 +48,10 @@ static void*         uiBufferTmp;      /* Temporary uiBuffer used by repainter *
 static SDL_SpinLock  uiBufferLock;     /* Lock for concurrent access to UI buffer between m68k thread and repainter */
 static Uint32        mask;             /* green screen mask for transparent UI areas */
 static volatile bool doRepaint  = true; /* Repaint thread runs while true */
+static SDL_sem*      frameReady;       /* Posted on every guest VBL when the VBL is locked to vsync */
+static SDL_SpinLock  vsyncLock;        /* Lock for vsyncTime and vsyncPeriod */
+static Uint64        vsyncTime;        /* host_time_us() of the last present */
+static Uint64        vsyncPeriod;      /* Smoothed host vsync period in microseconds */
 static SDL_Rect      statusBar;
 
 
@@ -189,16 +194,57 @@ static void blitScreen(SDL_Texture* tex) {
     }
 }
 
+/*
+ Measure the host vsync period in real time. Called after each present.
+ */
+static void measureVsync(void) {
+    Uint64 now = host_real_time_us();
+    
+    SDL_AtomicLock(&vsyncLock);
+    Uint64 delta = now - vsyncTime;
+    if(vsyncPeriod == 0) {
+        /* first measurement, accept anything plausible (20-200Hz) */
+        if(delta >= 5000 && delta <= 50000)
+            vsyncPeriod = delta;
+    } else if(delta > vsyncPeriod / 2 && delta < vsyncPeriod * 2) {
+        vsyncPeriod = (vsyncPeriod * 7 + delta) / 8;
+    }
+    vsyncTime = now;
+    SDL_AtomicUnlock(&vsyncLock);
+}
+
+/*
+ Get real time and period of the host vsync. Returns false if the
+ period is not known yet.
+ */
+bool Screen_GetVsync(Uint64* time, Uint64* period) {
+    SDL_AtomicLock(&vsyncLock);
+    *time   = vsyncTime;
+    *period = vsyncPeriod;
+    SDL_AtomicUnlock(&vsyncLock);
+    return *period != 0;
+}
+
+/*
+ Signal a new guest frame to the repaint thread.
+ */
+void Screen_FrameReady(void) {
+    if(SDL_SemValue(frameReady) == 0)
+        SDL_SemPost(frameReady);
+}
+
 /*
  Initializes SDL graphics and then enters repaint loop.
  Loop: Blits the NeXT framebuffer to the fbTexture, blends with the GUI surface and
- shows it.
+ shows it. If the VBL is locked to vsync, the framebuffer is only converted once per
+ guest frame.
  */
 static int repainter(void* unused) {
     int width;
     int height;
 
     SDL_SetThreadPriority(SDL_THREAD_PRIORITY_NORMAL);
+    host_thread_setup(THREAD_RENDER);
     SDL_GetWindowSize(sdlWindow, &width, &height);
     
     statusBar.x = 0;
@@ -271,10 +317,16 @@ static int repainter(void* unused) {
     
     /* Enter repaint loop */
     while(doRepaint) {
+        bool newFrame = true;
+        if(ConfigureParams.Screen.bVsyncLock) {
+            // Wait for the guest VBL, but keep the UI alive while emulation is paused
+            newFrame = SDL_SemWaitTimeout(frameReady, 100) == 0;
+        }
+        
         SDL_RenderClear(sdlRenderer);
         
         // Blit the NeXT framebuffer to textrue
-        blitScreen(fbTexture);
+        if(newFrame) blitScreen(fbTexture);
         // Render NeXT framebuffer texture
         SDL_RenderCopy(sdlRenderer, fbTexture, NULL, NULL);
         
@@ -300,6 +352,7 @@ static int repainter(void* unused) {
         
         // SDL_RenderPresent sleeps until next VSYNC because of SDL_RENDERER_PRESENTVSYNC in ScreenInit
         SDL_RenderPresent(sdlRenderer);
+        measureVsync();
     }
     return 0;
 }
@@ -349,6 +402,7 @@ void Screen_Init(void) {
     }
 
     initLatch     = SDL_CreateSemaphore(0);
+    frameReady    = SDL_CreateSemaphore(0);
     repaintThread = SDL_CreateThread(repainter, "[Previous] screen repaint", NULL);
     SDL_SemWait(initLatch);
 }
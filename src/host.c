@@ -1,5 +1,9 @@
 #include "config.h"
 
+#if HAVE_PTHREAD_SETAFFINITY_NP && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
 #if HAVE_NANOSLEEP
 #ifdef __MINGW32__
 #include <unistd.h>
@@ -8,6 +12,13 @@
 #endif
 #endif
 #include <errno.h>
+#if HAVE_PTHREAD_SETAFFINITY_NP || HAVE_PTHREAD_SETSCHEDPARAM
+#include <pthread.h>
+#include <sched.h>
+#endif
+#if HAVE_MLOCKALL
+#include <sys/mman.h>
+#endif
 
 #include "host.h"
 #include "configuration.h"
@@ -25,47 +36,135 @@ static const char* BLANKS[] = {
 static volatile Uint32 blank[NUM_BLANKS];
 static Uint32       vblCounter[NUM_BLANKS];
 static Uint64       perfCounterStart;
+static Uint64       perfFrequency;
+static Uint64       perfTicksPerUs;
 static Sint64       cycleCounterStart;
-static double       cycleSecsStart;
+static Uint64       cycleUsStart;
+static Sint64       cycleFrequency;
 static bool         isRealtime;
-static bool         oldIsRealtime;
-static double       cycleDivisor;
-static lock_t       timeLock;
+static volatile bool realtimeClock;
 static Uint32       ticksStart;
 static bool         enableRealtime;
 static Uint64       hardClockExpected;
 static Uint64       hardClockActual;
+static Uint32       hardClockCount;
+static Uint64       hardClockJitter;
+static Uint32       hardClockMaxJitter;
 static time_t       unixTimeStart;
 static double       unixTimeOffset = 0;
-static double       perfFrequency;
-static double       realTimeOffset;
 static Uint64       pauseTimeStamp;
 static bool         osDarkmatter;
+static int          governorSpeed;
+static Sint64       governorCycles;
+static Uint64       governorUs;
+static Uint32       governorLag;
+static Sint64       governorError;
+static Uint64       idleUs;
+
+/* Sequence counter for lock-free readers of the time base above. It is odd
+ * while the CPU thread updates the time base. */
+static volatile Uint32 timeBaseSeq;
+
+/* Semaphore to wake up the CPU thread from host_sleep_idle_us() */
+static SDL_sem*     wakeSem;
+
+static void host_update_clock(void);
+static Sint64 host_governor_offset(Uint64 realTime);
 
 void host_reset() {
+    timeBaseSeq++;
+    SDL_MemoryBarrierRelease();
     perfCounterStart  = SDL_GetPerformanceCounter();
     pauseTimeStamp    = perfCounterStart;
     perfFrequency     = SDL_GetPerformanceFrequency();
+    perfTicksPerUs    = (perfFrequency % 1000000) ? 0 : perfFrequency / 1000000;
     ticksStart        = SDL_GetTicks();
     unixTimeStart     = time(NULL);
     cycleCounterStart = 0;
-    cycleSecsStart    = 0;
+    cycleUsStart      = 0;
+    cycleFrequency    = ConfigureParams.System.nCpuFreq;
     isRealtime        = false;
-    oldIsRealtime     = false;
+    realtimeClock     = false;
     hardClockExpected = 0;
     hardClockActual   = 0;
+    hardClockCount    = 0;
+    hardClockJitter   = 0;
+    hardClockMaxJitter = 0;
     enableRealtime    = ConfigureParams.System.bRealtime;
-    realTimeOffset    = 0;
     osDarkmatter      = false;
+    governorSpeed     = 0;
+    governorLag       = 0;
+    governorError     = 0;
+    idleUs            = 0;
+    SDL_MemoryBarrierRelease();
+    timeBaseSeq++;
+    
+    if(!(wakeSem))
+        wakeSem = SDL_CreateSemaphore(0);
     
     for(int i = NUM_BLANKS; --i >= 0;) {
         vblCounter[i] = 0;
         blank[i]      = 0;
     }
     
-    cycleDivisor = ConfigureParams.System.nCpuFreq * 1000 * 1000;
-    
     SDL_SetThreadPriority(SDL_THREAD_PRIORITY_HIGH);
+    host_thread_setup(THREAD_CPU);
+    host_lock_memory();
+}
+
+static const char* THREAD_NAMES[THREAD_COUNT] = {
+    "cpu","i860","render","audio","slirp"
+};
+
+/* Apply the configured core and scheduling policy to the calling thread.
+ * Only the CPU, audio and render threads get a realtime policy, the i860
+ * thread spins and would starve everything else on its core. */
+void host_thread_setup(int thread) {
+#if HAVE_PTHREAD_SETAFFINITY_NP
+    int core = ConfigureParams.System.nThreadCore[thread];
+    if(core >= 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(core, &set);
+        if(pthread_setaffinity_np(pthread_self(), sizeof(set), &set))
+            fprintf(stderr, "[Host] Can't pin %s thread to core %d\n", THREAD_NAMES[thread], core);
+    }
+#endif
+#if HAVE_PTHREAD_SETSCHEDPARAM
+    if(ConfigureParams.System.nSchedPolicy != SCHED_POLICY_OTHER) {
+        struct sched_param param;
+        int policy = ConfigureParams.System.nSchedPolicy == SCHED_POLICY_FIFO ? SCHED_FIFO : SCHED_RR;
+        int prio   = ConfigureParams.System.nSchedPriority;
+        int err;
+        
+        switch(thread) {
+            case THREAD_CPU:
+            case THREAD_AUDIO:  break;
+            case THREAD_RENDER: prio--; break;
+            default:            return;
+        }
+        if(prio > sched_get_priority_max(policy)) prio = sched_get_priority_max(policy);
+        if(prio < sched_get_priority_min(policy)) prio = sched_get_priority_min(policy);
+        param.sched_priority = prio;
+        err = pthread_setschedparam(pthread_self(), policy, &param);
+        if(err)
+            fprintf(stderr, "[Host] Can't set %s priority %d for %s thread: %s\n",
+                    policy == SCHED_FIFO ? "SCHED_FIFO" : "SCHED_RR", prio, THREAD_NAMES[thread], strerror(err));
+    }
+#endif
+}
+
+/* Lock guest memory (which is allocated statically) into RAM. */
+void host_lock_memory(void) {
+#if HAVE_MLOCKALL
+    static bool locked = false;
+    if(ConfigureParams.System.bLockMemory && !(locked)) {
+        if(mlockall(MCL_CURRENT))
+            fprintf(stderr, "[Host] Can't lock memory: %s\n", strerror(errno));
+        else
+            locked = true;
+    }
+#endif
 }
 
 void host_blank(int slot, int src, bool state) {
@@ -91,68 +190,128 @@ void host_hardclock(int expected, int actual) {
     if(abs(actual-expected) > 1000)
         fprintf(stderr, "[Hardclock] expected:%dus actual:%dus\n", expected, actual);
     else {
+        Uint32 jitter = abs(actual-expected);
         hardClockExpected += expected;
         hardClockActual   += actual;
+        hardClockCount++;
+        hardClockJitter   += jitter;
+        if(jitter > hardClockMaxJitter)
+            hardClockMaxJitter = jitter;
     }
 }
 
 extern Sint64 nCyclesMainCounter;
 
-void host_realtime(bool state) {
-    isRealtime = state;
+static inline Uint64 host_real_time_us_raw(void) {
+    Uint64 ticks = SDL_GetPerformanceCounter() - perfCounterStart;
+    if(perfTicksPerUs)
+        return ticks / perfTicksPerUs;
+    return (ticks / perfFrequency) * 1000000 + ((ticks % perfFrequency) * 1000000) / perfFrequency;
 }
 
-double host_time_sec() {
-    double rt;
-    double vt;
-    host_time(&rt, &vt);
-    return vt;
+static inline Uint64 host_cycle_time_us_raw(void) {
+    return cycleUsStart + (nCyclesMainCounter - cycleCounterStart) / cycleFrequency;
 }
 
-void host_time(double* realTime, double* hostTime) {
-    host_lock(&timeLock);
-    
-    *realTime  = (SDL_GetPerformanceCounter() - perfCounterStart);
-    *realTime /= perfFrequency;
-    
-    if(oldIsRealtime) {
-        *hostTime = *realTime;
-    } else {
-        *hostTime  = nCyclesMainCounter - cycleCounterStart;
-        *hostTime /= cycleDivisor;
-        *hostTime += cycleSecsStart;
-    }
+/* Read real time and emulated host time in microseconds without locking.
+ * Readers retry if the CPU thread switched the time base meanwhile. */
+static inline void host_time_us_both(Uint64* realTime, Uint64* hostTime) {
+    Uint32 seq;
+    do {
+        seq = timeBaseSeq;
+        SDL_MemoryBarrierAcquire();
+        *realTime = host_real_time_us_raw();
+        *hostTime = realtimeClock ? *realTime : host_cycle_time_us_raw();
+        SDL_MemoryBarrierAcquire();
+    } while((seq & 1) || seq != timeBaseSeq);
+}
+
+/* Switch between real-time and cycle-time. Only called from the CPU
+ * thread when one of the inputs of the clock selection changes. */
+static void host_update_clock(void) {
     bool state = (isRealtime || osDarkmatter) && enableRealtime;
-    if(oldIsRealtime != state) {
-        if(oldIsRealtime) {
-            // switching from real-time to cycle-time
-            cycleSecsStart = *realTime;
-            cycleCounterStart = nCyclesMainCounter;
-        } else {
-            // switching from cycle-time to real-time
-            realTimeOffset = *hostTime - *realTime;
-            if(realTimeOffset > 0) {
-                // if hostTime is in the future, wait until realTime is there as well
-                if(realTimeOffset > 0.01)
-                    host_sleep_sec(realTimeOffset);
-                else
-                    while(*realTime < *hostTime) {
-                        *realTime  = (SDL_GetPerformanceCounter() - perfCounterStart);
-                        *realTime /= perfFrequency;
-                    }
-            }
+    if(realtimeClock == state)
+        return;
+
+    Uint64 realTime = host_real_time_us_raw();
+    if(realtimeClock) {
+        // switching from real-time to cycle-time, keep the governor error
+        if(governorSpeed && governorSpeed == ConfigureParams.System.nSpeedTarget)
+            governorError = host_governor_offset(realTime);
+        timeBaseSeq++;
+        SDL_MemoryBarrierRelease();
+        cycleUsStart      = realTime;
+        cycleCounterStart = nCyclesMainCounter;
+        realtimeClock     = false;
+        SDL_MemoryBarrierRelease();
+        timeBaseSeq++;
+    } else {
+        // switching from cycle-time to real-time
+        Uint64 hostTime = host_cycle_time_us_raw();
+        if(hostTime > realTime) {
+            // if hostTime is in the future, wait until realTime is there as well
+            if(hostTime - realTime > 10000)
+                host_sleep_us(hostTime - realTime);
+            else
+                while(host_real_time_us_raw() < hostTime) {}
         }
-        oldIsRealtime = state;
+        // cycles run on cycle-time don't count, rebase with the error kept
+        governorCycles = nCyclesMainCounter;
+        governorUs     = host_real_time_us_raw() + governorError;
+        governorError  = 0;
+        timeBaseSeq++;
+        SDL_MemoryBarrierRelease();
+        realtimeClock = true;
+        SDL_MemoryBarrierRelease();
+        timeBaseSeq++;
     }
-    
-    realTimeOffset = *hostTime - *realTime;
+}
+
+void host_realtime(bool state) {
+    isRealtime = state;
+    host_update_clock();
+}
+
+double host_time_sec() {
+    return host_time_us() / (1000.0 * 1000.0);
+}
 
-    host_unlock(&timeLock);
+void host_time(double* realTime, double* hostTime) {
+    Uint64 rt, vt;
+    host_time_us_both(&rt, &vt);
+    *realTime = rt / (1000.0 * 1000.0);
+    *hostTime = vt / (1000.0 * 1000.0);
 }
 
 // Return current time as micro seconds
 Uint64 host_time_us() {
-    return host_time_sec() * 1000.0 * 1000.0;
+    Uint32 seq;
+    Uint64 result;
+    do {
+        seq = timeBaseSeq;
+        SDL_MemoryBarrierAcquire();
+        result = realtimeClock ? host_real_time_us_raw() : host_cycle_time_us_raw();
+        SDL_MemoryBarrierAcquire();
+    } while((seq & 1) || seq != timeBaseSeq);
+    return result;
+}
+
+// Return real time as micro seconds, whichever clock host_time_us() follows
+Uint64 host_real_time_us() {
+    Uint32 seq;
+    Uint64 result;
+    do {
+        seq = timeBaseSeq;
+        SDL_MemoryBarrierAcquire();
+        result = host_real_time_us_raw();
+        SDL_MemoryBarrierAcquire();
+    } while((seq & 1) || seq != timeBaseSeq);
+    return result;
+}
+
+// Return true if host_time_us() currently follows real time
+bool host_time_is_real() {
+    return realtimeClock;
 }
 
 // Return current time as milliseconds
@@ -168,21 +327,78 @@ void host_set_unix_time(time_t now) {
     unixTimeOffset += difftime(now, host_unix_time());
 }
 
+/* Maximum time in microseconds the governor lets the CPU fall behind */
+#define GOVERNOR_MAX_LAG 50000
+
+/* Speed governor for real-time mode. Compares the real time the cycles run
+ * since the last rebase should have taken at the target speed with the
+ * real time that actually passed. The error is integrated over all cycles,
+ * so the average speed converges to the target without drift. If the host
+ * can't keep up, the base is moved along instead of racing to catch up. */
+static Sint64 host_governor_offset(Uint64 realTime) {
+    Sint64 offset;
+    
+    if(governorSpeed != ConfigureParams.System.nSpeedTarget) {
+        governorSpeed  = ConfigureParams.System.nSpeedTarget;
+        governorCycles = nCyclesMainCounter;
+        governorUs     = realTime;
+        return 0;
+    }
+    
+    offset  = (Sint64)governorUs + ((nCyclesMainCounter - governorCycles) * 100) / (cycleFrequency * governorSpeed);
+    offset -= (Sint64)realTime;
+    if(offset < -GOVERNOR_MAX_LAG) {
+        governorCycles = nCyclesMainCounter;
+        governorUs     = realTime;
+        governorLag++;
+        offset = 0;
+    }
+    return offset;
+}
+
 double host_real_time_offset() {
-    host_lock(&timeLock);
-    double result = realTimeOffset;
-    host_unlock(&timeLock);
-    return result;
+    Uint64 rt, vt;
+    host_time_us_both(&rt, &vt);
+    if(realtimeClock && ConfigureParams.System.nSpeedTarget)
+        return host_governor_offset(rt) / (1000.0 * 1000.0);
+    return ((Sint64)(vt - rt)) / (1000.0 * 1000.0);
+}
+
+/* Account real time the CPU thread spent waiting because it was ahead */
+void host_idle_us(Uint64 us) {
+    idleUs += us;
+}
+
+double host_idle_sec() {
+    return idleUs / (1000.0 * 1000.0);
 }
 
 void host_pause_time(bool pausing) {
     if(pausing) {
         pauseTimeStamp = SDL_GetPerformanceCounter();
     } else {
+        timeBaseSeq++;
+        SDL_MemoryBarrierRelease();
         perfCounterStart += SDL_GetPerformanceCounter() - pauseTimeStamp;
+        SDL_MemoryBarrierRelease();
+        timeBaseSeq++;
     }
 }
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Emulated time skipped ahead while the CPU was idle. Move the real time
+ * base along so the warp does not count as running ahead of real time.
+ */
+void host_warp(Sint64 cycles) {
+    Uint64 us = cycles / cycleFrequency;
+    timeBaseSeq++;
+    SDL_MemoryBarrierRelease();
+    perfCounterStart -= perfTicksPerUs ? us * perfTicksPerUs : (us * perfFrequency) / 1000000;
+    SDL_MemoryBarrierRelease();
+    timeBaseSeq++;
+}
+
 /*-----------------------------------------------------------------------*/
 /**
  * Sleep for a given number of micro seconds. We burn cycles by running
@@ -206,6 +422,44 @@ void host_sleep_us(Uint64 us) {
 #endif
 }
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Sleep for the given number of micro seconds of real time. Long sleeps
+ * wait on a semaphore and return early if another thread calls host_wake().
+ * Returns the number of micro seconds left when woken up early.
+ */
+Uint64 host_sleep_idle_us(Uint64 us) {
+    Uint64 now      = host_real_time_us_raw();
+    Uint64 deadline = now + us;
+
+    if(us > 2000) {
+        /* coarse wait with millisecond resolution */
+        if(SDL_SemWaitTimeout(wakeSem, (Uint32)((us - 1000) / 1000)) == 0) {
+            now = host_real_time_us_raw();
+            return now < deadline ? deadline - now : 0;
+        }
+        now = host_real_time_us_raw();
+        if(now >= deadline) return 0;
+    }
+    
+    if(SDL_SemTryWait(wakeSem) == 0)
+        return deadline - now;
+    
+    /* fine wait for the remaining time */
+    host_sleep_us(deadline - now);
+    return 0;
+}
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Wake up the CPU thread if it sleeps in host_sleep_idle_us(). Can be
+ * called from any thread.
+ */
+void host_wake(void) {
+    if(wakeSem && SDL_SemValue(wakeSem) == 0)
+        SDL_SemPost(wakeSem);
+}
+
 void host_sleep_ms(Uint32 ms) {
     Uint64 sleep = ms;
     sleep *= 1000;
@@ -245,9 +499,12 @@ int host_num_cpus() {
  
 void host_darkmatter(bool state) {
     osDarkmatter = state;
+    host_update_clock();
 }
                   
 static double lastVT;
+static double lastRT;
+static double lastIdle;
 static char   report[512];
 
 const char* host_report(double realTime, double hostTime) {
@@ -258,13 +515,27 @@ const char* host_report(double realTime, double hostTime) {
     
     char* r = report;
     r += sprintf(r, "[%s] hostTime:%.1f hardClock:%.3fMHz", enableRealtime ? "Max.speed" : "CycleTime", hostTime, hardClock);
+    if(hardClockCount) {
+        r += sprintf(r, " hardClockJitter:avg=%dus max=%dus", (int)(hardClockJitter / hardClockCount), hardClockMaxJitter);
+        hardClockCount     = 0;
+        hardClockJitter    = 0;
+        hardClockMaxJitter = 0;
+    }
+
+    if(realtimeClock && ConfigureParams.System.nSpeedTarget) {
+        r += sprintf(r, " governor:%d%% idle:%.1f%% lag:%d", ConfigureParams.System.nSpeedTarget,
+                     100.0 * (host_idle_sec() - lastIdle) / (realTime - lastRT), governorLag);
+        governorLag = 0;
+    }
 
     for(int i = NUM_BLANKS; --i >= 0;) {
         r += sprintf(r, " %s:%.1fHz", BLANKS[i], (double)vblCounter[i]/dVT);
         vblCounter[i] = 0;
     }
     
-    lastVT = hostTime;
+    lastVT   = hostTime;
+    lastRT   = realTime;
+    lastIdle = host_idle_sec();
 
     return report;
 }
\ No newline at end of file
@@ -228,6 +228,8 @@ typedef struct
   bool bFullScreen;
   bool bShowStatusbar;
   bool bShowDriveLed;
+  bool bVsyncLock;                /* TRUE if the VBL should follow the host vsync */
+  int nVsyncTolerance;            /* Max. deviation of host from NeXT refresh rate in percent */
 } CNF_SCREEN;
 
 
@@ -282,6 +284,24 @@ typedef enum
   FPU_CPU = 68040
 } FPUTYPE;
 
+typedef enum
+{
+  SCHED_POLICY_OTHER,
+  SCHED_POLICY_FIFO,
+  SCHED_POLICY_RR
+} SCHEDPOLICY;
+
+/* Host threads that can be pinned to a core */
+typedef enum
+{
+  THREAD_CPU,
+  THREAD_I860,
+  THREAD_RENDER,
+  THREAD_AUDIO,
+  THREAD_SLIRP,
+  THREAD_COUNT
+} HOSTTHREAD;
+
 typedef struct
 {
   bool bColor;
@@ -294,12 +314,20 @@ typedef struct
   bool bCompatibleCpu;            /* Prefetch mode */
   MACHINETYPE nMachineType;
   bool bRealtime;                 /* TRUE if realtime sources shoud be used */
+  bool bIdleWarp;                 /* TRUE if idle periods should be skipped in cycle-time mode */
+  bool bThreadedDispatch;         /* TRUE to use the threaded 68030 dispatcher, if built in */
+  int nCoprocQuantum;             /* CPU cycles DSP and i860 may run behind the CPU */
+  int nSpeedTarget;               /* Realtime speed in percent of nCpuFreq, 0 for unlimited */
   DSPTYPE nDSPType;               /* how to "emulate" DSP */
   bool bDSPMemoryExpansion;
   bool bRealTimeClock;
   FPUTYPE n_FPUType;
   bool bCompatibleFPU;            /* More compatible FPU */
   bool bMMU;                      /* TRUE if MMU is enabled */
+  SCHEDPOLICY nSchedPolicy;       /* Host scheduling policy for time critical threads */
+  int nSchedPriority;             /* Priority for SCHED_FIFO/SCHED_RR */
+  int nThreadCore[THREAD_COUNT];  /* Host core for each thread, -1 for any */
+  bool bLockMemory;               /* TRUE if memory should be locked into RAM */
 } CNF_SYSTEM;
 
 typedef struct
@@ -46,8 +46,8 @@ enum {
 
 typedef struct
 {
-    int     type;   /* Type of time (CPU Cycles, microseconds) or NONE for inactive */
-    int64_t time;   /* number of CPU cycles to go until interupt or absolute microsecond timeout until interrupt */
+    int     type;   /* CYC_INT_CPU if an event is pending or NONE if the event heap is empty */
+    int64_t time;   /* number of CPU cycles to go until the next event */
     void (*pFunction)(void);
 } INTERRUPTHANDLER;
 
@@ -55,8 +55,6 @@ INTERRUPTHANDLER PendingInterrupt;
 
 extern int64_t nCyclesMainCounter;
 
-extern int usCheckCycles;
-
 void CycInt_Reset(void);
 void CycInt_MemorySnapShot_Capture(bool bSave);
 void CycInt_AcknowledgeInterrupt(void);
@@ -65,6 +63,10 @@ void CycInt_AddRelativeInterruptTicks(int64_t TickTime, interrupt_id Handler);
 void CycInt_AddRelativeInterruptUs(int64_t us, interrupt_id Handler);
 void CycInt_RemovePendingInterrupt(interrupt_id Handler);
 bool CycInt_InterruptActive(interrupt_id Handler);
-bool CycInt_SetNewInterruptUs(void);
+int64_t CycInt_Idle(void);
+int64_t CycInt_Warp(void);
+void CycInt_ResetStats(void);
+void CycInt_Info(FILE *fp);
+const char* CycInt_Report(double realTime, double hostTime);
 
 #endif /* ifndef HATARI_CYCINT_H */
@@ -38,6 +38,28 @@ void DMA_Stop_Write(void);
 void DMA_Init_Read(void);
 void DMA_Init_Write(void);
 
+/* Native long handlers for the DMA registers */
+Uint32 DMA_CSR_ReadLong(Uint32 addr);
+void DMA_CSR_WriteLong(Uint32 addr, Uint32 val);
+Uint32 DMA_Saved_Next_ReadLong(Uint32 addr);
+void DMA_Saved_Next_WriteLong(Uint32 addr, Uint32 val);
+Uint32 DMA_Saved_Limit_ReadLong(Uint32 addr);
+void DMA_Saved_Limit_WriteLong(Uint32 addr, Uint32 val);
+Uint32 DMA_Saved_Start_ReadLong(Uint32 addr);
+void DMA_Saved_Start_WriteLong(Uint32 addr, Uint32 val);
+Uint32 DMA_Saved_Stop_ReadLong(Uint32 addr);
+void DMA_Saved_Stop_WriteLong(Uint32 addr, Uint32 val);
+Uint32 DMA_Next_ReadLong(Uint32 addr);
+void DMA_Next_WriteLong(Uint32 addr, Uint32 val);
+Uint32 DMA_Limit_ReadLong(Uint32 addr);
+void DMA_Limit_WriteLong(Uint32 addr, Uint32 val);
+Uint32 DMA_Start_ReadLong(Uint32 addr);
+void DMA_Start_WriteLong(Uint32 addr, Uint32 val);
+Uint32 DMA_Stop_ReadLong(Uint32 addr);
+void DMA_Stop_WriteLong(Uint32 addr, Uint32 val);
+Uint32 DMA_Init_ReadLong(Uint32 addr);
+void DMA_Init_WriteLong(Uint32 addr, Uint32 val);
+
 /* Turbo DMA functions */
 void TDMA_CSR_Read(void);
 void TDMA_CSR_Write(void);
@@ -40,6 +40,8 @@ extern "C" {
     void        host_blank(int slot, int src, bool state);
     bool        host_blank_state(int slot, int src);
     Uint64      host_time_us(void);
+    Uint64      host_real_time_us(void);
+    bool        host_time_is_real(void);
     Uint32      host_time_ms(void);
     double      host_time_sec(void);
     void        host_time(double* realTime, double* hostTime);
@@ -48,12 +50,19 @@ extern "C" {
     void        host_sleep_sec(double sec);
     void        host_sleep_ms(Uint32 ms);
     void        host_sleep_us(Uint64 us);
+    Uint64      host_sleep_idle_us(Uint64 us);
+    void        host_wake(void);
     int         host_num_cpus(void);
     void        host_hardclock(int expected, int actual);
     double      host_real_time_offset(void);
+    void        host_idle_us(Uint64 us);
+    double      host_idle_sec(void);
     void        host_pause_time(bool pausing);
+    void        host_warp(int64_t cycles);
     const char* host_report(double realTime, double hostTime);
     void        host_darkmatter(bool state);
+    void        host_thread_setup(int thread);
+    void        host_lock_memory(void);
     
     void        host_lock(lock_t* lock);
     void        host_unlock(lock_t* lock);
@@ -15,6 +15,8 @@ typedef struct
     const int SpanInBytes;    /* E.g. SIZE_BYTE, SIZE_WORD or SIZE_LONG */
     void (*ReadFunc)(void);   /* Read function */
     void (*WriteFunc)(void);  /* Write function */
+    Uint32 (*ReadLongFunc)(Uint32 addr);             /* Optional, aligned long read of a SIZE_LONG register */
+    void (*WriteLongFunc)(Uint32 addr, Uint32 val);  /* Optional, aligned long write of a SIZE_LONG register */
 } INTERCEPT_ACCESS_FUNC;
 
 extern const INTERCEPT_ACCESS_FUNC IoMemTable_NEXT[];
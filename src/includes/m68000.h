@@ -147,16 +147,25 @@ extern const char *OpcodeName[];
  * Add CPU cycles.
  */
 static inline void M68000_AddCycles(int cycles) {
-    if(PendingInterrupt.type == CYC_INT_CPU)
-        PendingInterrupt.time -= cycles;
-
-    if(usCheckCycles < 0) {
-        if(!(CycInt_SetNewInterruptUs())) {
-            usCheckCycles = 100 * ConfigureParams.System.nCpuFreq;
-        }
-    } else
-        usCheckCycles -= cycles;
-    nCyclesMainCounter += cycles;
+    PendingInterrupt.time -= cycles;
+    nCyclesMainCounter    += cycles;
+}
+
+extern int nCoprocCycles;
+
+void M68000_SyncCoprocessors(void);
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Let DSP and i860 catch up with the CPU. They run in quanta of
+ * ConfigureParams.System.nCoprocQuantum CPU cycles. A quantum is cut
+ * short by the instruction that reaches the next CycInt deadline, so
+ * the coprocessors are caught up before the event handler runs.
+ */
+static inline void M68000_AddCoprocCycles(int cycles) {
+    nCoprocCycles += cycles;
+    if (nCoprocCycles >= ConfigureParams.System.nCoprocQuantum || PendingInterrupt.time <= 0)
+        M68000_SyncCoprocessors();
 }
 
 void M68000_Init(void);
@@ -29,5 +29,7 @@ bool Update_StatusBar(void);
 void SDL_UpdateRects(SDL_Surface *screen, int numrects, SDL_Rect *rects);
 void SDL_UpdateRect(SDL_Surface *screen, Sint32 x, Sint32 y, Sint32 w, Sint32 h);
 void blitDimension(SDL_Texture* tex);
+bool Screen_GetVsync(Uint64* time, Uint64* period);
+void Screen_FrameReady(void);
 
 #endif  /* ifndef HATARI_SCREEN_H */
@@ -72,6 +72,10 @@ void IntRegStatRead(void);
 void IntRegStatWrite(void);
 void IntRegMaskRead(void);
 void IntRegMaskWrite(void);
+Uint32 IntRegStatReadLong(Uint32 addr);
+void IntRegStatWriteLong(Uint32 addr, Uint32 val);
+Uint32 IntRegMaskReadLong(Uint32 addr);
+void IntRegMaskWriteLong(Uint32 addr, Uint32 val);
 
 void Hardclock_InterruptHandler(void);
 void HardclockRead0(void);
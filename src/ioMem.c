@@ -23,6 +23,9 @@ const char IoMem_fileid[] = "Hatari ioMem.c : " __DATE__ " " __TIME__;
 static void (*pInterceptReadTable[IO_SIZE])(void);     /* Table with read access handlers */
 static void (*pInterceptWriteTable[IO_SIZE])(void);    /* Table with write access handlers */
 
+static Uint32 (*pLongReadTable[IO_SIZE/4])(Uint32);           /* Optional long read handlers, per long address */
+static void (*pLongWriteTable[IO_SIZE/4])(Uint32, Uint32);    /* Optional long write handlers, per long address */
+
 int nIoMemAccessSize;                                 /* Set to 1, 2 or 4 according to byte, word or long word access */
 Uint32 IoAccessBaseAddress;                           /* Stores the base address of the IO mem access */
 Uint32 IoAccessCurrentAddress;                        /* Current byte address while handling WORD and LONG accesses */
@@ -94,6 +97,23 @@ void IoMem_Init(void)
 		}
 	}
 
+	/* Registers that also have long handlers. Accesses of any other size
+	 * still go through the byte tables above. */
+	memset(pLongReadTable, 0, sizeof(pLongReadTable));
+	memset(pLongWriteTable, 0, sizeof(pLongWriteTable));
+	for (i=0; pInterceptAccessFuncs[i].Address != 0; i++)
+	{
+		if (pInterceptAccessFuncs[i].ReadLongFunc == NULL)
+			continue;
+		addr = pInterceptAccessFuncs[i].Address & IO_SEG_MASK;
+		if (pInterceptAccessFuncs[i].SpanInBytes != SIZE_LONG || (addr & 3))
+		{
+			fprintf(stderr, "IoMem_Init: Warning: long handler at $%x is not a long register\n", pInterceptAccessFuncs[i].Address);
+			continue;
+		}
+		pLongReadTable[addr>>2] = pInterceptAccessFuncs[i].ReadLongFunc;
+		pLongWriteTable[addr>>2] = pInterceptAccessFuncs[i].WriteLongFunc;
+	}
 
 }
 
@@ -213,6 +233,14 @@ uae_u32 IoMem_lget(uaecptr addr)
 	idx = addr & IO_SEG_MASK;
 
 	IoAccessCurrentAddress = addr;
+	if (!(idx & 3) && pLongReadTable[idx>>2])
+	{
+		val = pLongReadTable[idx>>2](addr);       /* One call for the whole register */
+		IoMem_WriteLong(addr, val);
+		LOG_TRACE(TRACE_IOMEM_RD, "IO read.l $%06x = $%08x\n", addr, val);
+		return val;
+	}
+
 	pInterceptReadTable[idx]();                   /* Call 1st handler */
 
 	if (pInterceptReadTable[idx+1] != pInterceptReadTable[idx])
@@ -348,6 +376,12 @@ void IoMem_lput(uaecptr addr, uae_u32 val)
 	idx = addr & IO_SEG_MASK;
 
 	IoAccessCurrentAddress = addr;
+	if (!(idx & 3) && pLongWriteTable[idx>>2])
+	{
+		pLongWriteTable[idx>>2](addr, val);       /* One call for the whole register */
+		return;
+	}
+
 	pInterceptWriteTable[idx]();                  /* Call handler */
 
 	if (pInterceptWriteTable[idx+1] != pInterceptWriteTable[idx])
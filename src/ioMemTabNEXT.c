@@ -38,116 +38,116 @@ const char IoMemTabNEXT_fileid[] = "Previous ioMemTabNEXT.c : " __DATE__ " " __T
 const INTERCEPT_ACCESS_FUNC IoMemTable_NEXT[] =
 {
 	/* DMA Controller (Fujitsu MB610313) (writes MUST be 32-bit) */
-	{ 0x02000010, SIZE_LONG, DMA_CSR_Read, DMA_CSR_Write },
-	{ 0x02000040, SIZE_LONG, DMA_CSR_Read, DMA_CSR_Write },
-	{ 0x02000050, SIZE_LONG, DMA_CSR_Read, DMA_CSR_Write },
-	{ 0x02000080, SIZE_LONG, DMA_CSR_Read, DMA_CSR_Write },
-	{ 0x02000090, SIZE_LONG, DMA_CSR_Read, DMA_CSR_Write },
-	{ 0x020000c0, SIZE_LONG, DMA_CSR_Read, DMA_CSR_Write },
-	{ 0x020000d0, SIZE_LONG, DMA_CSR_Read, DMA_CSR_Write },
-	{ 0x02000110, SIZE_LONG, DMA_CSR_Read, DMA_CSR_Write },
-	{ 0x02000150, SIZE_LONG, DMA_CSR_Read, DMA_CSR_Write },
-	{ 0x02000180, SIZE_LONG, DMA_CSR_Read, DMA_CSR_Write },
-	{ 0x020001d0, SIZE_LONG, DMA_CSR_Read, DMA_CSR_Write },
-	{ 0x020001c0, SIZE_LONG, DMA_CSR_Read, DMA_CSR_Write },
+	{ 0x02000010, SIZE_LONG, DMA_CSR_Read, DMA_CSR_Write, DMA_CSR_ReadLong, DMA_CSR_WriteLong },
+	{ 0x02000040, SIZE_LONG, DMA_CSR_Read, DMA_CSR_Write, DMA_CSR_ReadLong, DMA_CSR_WriteLong },
+	{ 0x02000050, SIZE_LONG, DMA_CSR_Read, DMA_CSR_Write, DMA_CSR_ReadLong, DMA_CSR_WriteLong },
+	{ 0x02000080, SIZE_LONG, DMA_CSR_Read, DMA_CSR_Write, DMA_CSR_ReadLong, DMA_CSR_WriteLong },
+	{ 0x02000090, SIZE_LONG, DMA_CSR_Read, DMA_CSR_Write, DMA_CSR_ReadLong, DMA_CSR_WriteLong },
+	{ 0x020000c0, SIZE_LONG, DMA_CSR_Read, DMA_CSR_Write, DMA_CSR_ReadLong, DMA_CSR_WriteLong },
+	{ 0x020000d0, SIZE_LONG, DMA_CSR_Read, DMA_CSR_Write, DMA_CSR_ReadLong, DMA_CSR_WriteLong },
+	{ 0x02000110, SIZE_LONG, DMA_CSR_Read, DMA_CSR_Write, DMA_CSR_ReadLong, DMA_CSR_WriteLong },
+	{ 0x02000150, SIZE_LONG, DMA_CSR_Read, DMA_CSR_Write, DMA_CSR_ReadLong, DMA_CSR_WriteLong },
+	{ 0x02000180, SIZE_LONG, DMA_CSR_Read, DMA_CSR_Write, DMA_CSR_ReadLong, DMA_CSR_WriteLong },
+	{ 0x020001d0, SIZE_LONG, DMA_CSR_Read, DMA_CSR_Write, DMA_CSR_ReadLong, DMA_CSR_WriteLong },
+	{ 0x020001c0, SIZE_LONG, DMA_CSR_Read, DMA_CSR_Write, DMA_CSR_ReadLong, DMA_CSR_WriteLong },
 	
 	/* Channel SCSI */
-	{ 0x02004010, SIZE_LONG, DMA_Next_Read, DMA_Next_Write },
-	{ 0x02004014, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write },
-	{ 0x02004018, SIZE_LONG, DMA_Start_Read, DMA_Start_Write },
-	{ 0x0200401c, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write },
-	{ 0x02004210, SIZE_LONG, DMA_Init_Read, DMA_Init_Write },
+	{ 0x02004010, SIZE_LONG, DMA_Next_Read, DMA_Next_Write, DMA_Next_ReadLong, DMA_Next_WriteLong },
+	{ 0x02004014, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write, DMA_Limit_ReadLong, DMA_Limit_WriteLong },
+	{ 0x02004018, SIZE_LONG, DMA_Start_Read, DMA_Start_Write, DMA_Start_ReadLong, DMA_Start_WriteLong },
+	{ 0x0200401c, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write, DMA_Stop_ReadLong, DMA_Stop_WriteLong },
+	{ 0x02004210, SIZE_LONG, DMA_Init_Read, DMA_Init_Write, DMA_Init_ReadLong, DMA_Init_WriteLong },
 	
 	/* Channel Sound out */
-	{ 0x02004030, SIZE_LONG, DMA_Saved_Next_Read, DMA_Saved_Next_Write },
-	{ 0x02004034, SIZE_LONG, DMA_Saved_Limit_Read, DMA_Saved_Limit_Write },
-	{ 0x02004038, SIZE_LONG, DMA_Saved_Start_Read, DMA_Saved_Start_Write },
-	{ 0x0200403c, SIZE_LONG, DMA_Saved_Stop_Read, DMA_Saved_Stop_Write },
-	{ 0x02004040, SIZE_LONG, DMA_Next_Read, DMA_Next_Write },
-	{ 0x02004044, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write },
-	{ 0x02004048, SIZE_LONG, DMA_Start_Read, DMA_Start_Write },
-	{ 0x0200404c, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write },
-	{ 0x02004240, SIZE_LONG, DMA_Init_Read, DMA_Init_Write },
+	{ 0x02004030, SIZE_LONG, DMA_Saved_Next_Read, DMA_Saved_Next_Write, DMA_Saved_Next_ReadLong, DMA_Saved_Next_WriteLong },
+	{ 0x02004034, SIZE_LONG, DMA_Saved_Limit_Read, DMA_Saved_Limit_Write, DMA_Saved_Limit_ReadLong, DMA_Saved_Limit_WriteLong },
+	{ 0x02004038, SIZE_LONG, DMA_Saved_Start_Read, DMA_Saved_Start_Write, DMA_Saved_Start_ReadLong, DMA_Saved_Start_WriteLong },
+	{ 0x0200403c, SIZE_LONG, DMA_Saved_Stop_Read, DMA_Saved_Stop_Write, DMA_Saved_Stop_ReadLong, DMA_Saved_Stop_WriteLong },
+	{ 0x02004040, SIZE_LONG, DMA_Next_Read, DMA_Next_Write, DMA_Next_ReadLong, DMA_Next_WriteLong },
+	{ 0x02004044, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write, DMA_Limit_ReadLong, DMA_Limit_WriteLong },
+	{ 0x02004048, SIZE_LONG, DMA_Start_Read, DMA_Start_Write, DMA_Start_ReadLong, DMA_Start_WriteLong },
+	{ 0x0200404c, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write, DMA_Stop_ReadLong, DMA_Stop_WriteLong },
+	{ 0x02004240, SIZE_LONG, DMA_Init_Read, DMA_Init_Write, DMA_Init_ReadLong, DMA_Init_WriteLong },
 	
 	/* Channel MO Drive */
-	{ 0x02004050, SIZE_LONG, DMA_Next_Read, DMA_Next_Write },
-	{ 0x02004054, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write },
-	{ 0x02004058, SIZE_LONG, DMA_Start_Read, DMA_Start_Write },
-	{ 0x0200405c, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write },
-	{ 0x02004250, SIZE_LONG, DMA_Init_Read, DMA_Init_Write },
+	{ 0x02004050, SIZE_LONG, DMA_Next_Read, DMA_Next_Write, DMA_Next_ReadLong, DMA_Next_WriteLong },
+	{ 0x02004054, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write, DMA_Limit_ReadLong, DMA_Limit_WriteLong },
+	{ 0x02004058, SIZE_LONG, DMA_Start_Read, DMA_Start_Write, DMA_Start_ReadLong, DMA_Start_WriteLong },
+	{ 0x0200405c, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write, DMA_Stop_ReadLong, DMA_Stop_WriteLong },
+	{ 0x02004250, SIZE_LONG, DMA_Init_Read, DMA_Init_Write, DMA_Init_ReadLong, DMA_Init_WriteLong },
 	
 	/* Channel Sound in */
-	{ 0x02004070, SIZE_LONG, DMA_Saved_Next_Read, DMA_Saved_Next_Write },
-	{ 0x02004074, SIZE_LONG, DMA_Saved_Limit_Read, DMA_Saved_Limit_Write },
-	{ 0x02004078, SIZE_LONG, DMA_Saved_Start_Read, DMA_Saved_Start_Write },
-	{ 0x0200407c, SIZE_LONG, DMA_Saved_Stop_Read, DMA_Saved_Stop_Write },
-	{ 0x02004080, SIZE_LONG, DMA_Next_Read, DMA_Next_Write },
-	{ 0x02004084, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write },
-	{ 0x02004088, SIZE_LONG, DMA_Start_Read, DMA_Start_Write },
-	{ 0x0200408c, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write },
-	{ 0x02004280, SIZE_LONG, DMA_Init_Read, DMA_Init_Write },
+	{ 0x02004070, SIZE_LONG, DMA_Saved_Next_Read, DMA_Saved_Next_Write, DMA_Saved_Next_ReadLong, DMA_Saved_Next_WriteLong },
+	{ 0x02004074, SIZE_LONG, DMA_Saved_Limit_Read, DMA_Saved_Limit_Write, DMA_Saved_Limit_ReadLong, DMA_Saved_Limit_WriteLong },
+	{ 0x02004078, SIZE_LONG, DMA_Saved_Start_Read, DMA_Saved_Start_Write, DMA_Saved_Start_ReadLong, DMA_Saved_Start_WriteLong },
+	{ 0x0200407c, SIZE_LONG, DMA_Saved_Stop_Read, DMA_Saved_Stop_Write, DMA_Saved_Stop_ReadLong, DMA_Saved_Stop_WriteLong },
+	{ 0x02004080, SIZE_LONG, DMA_Next_Read, DMA_Next_Write, DMA_Next_ReadLong, DMA_Next_WriteLong },
+	{ 0x02004084, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write, DMA_Limit_ReadLong, DMA_Limit_WriteLong },
+	{ 0x02004088, SIZE_LONG, DMA_Start_Read, DMA_Start_Write, DMA_Start_ReadLong, DMA_Start_WriteLong },
+	{ 0x0200408c, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write, DMA_Stop_ReadLong, DMA_Stop_WriteLong },
+	{ 0x02004280, SIZE_LONG, DMA_Init_Read, DMA_Init_Write, DMA_Init_ReadLong, DMA_Init_WriteLong },
 	
 	/* Channel Printer */
-	{ 0x02004090, SIZE_LONG, DMA_Next_Read, DMA_Next_Write },
-	{ 0x02004094, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write },
-	{ 0x02004098, SIZE_LONG, DMA_Start_Read, DMA_Start_Write },
-	{ 0x0200409c, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write },
-	{ 0x02004290, SIZE_LONG, DMA_Init_Read, DMA_Init_Write },
+	{ 0x02004090, SIZE_LONG, DMA_Next_Read, DMA_Next_Write, DMA_Next_ReadLong, DMA_Next_WriteLong },
+	{ 0x02004094, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write, DMA_Limit_ReadLong, DMA_Limit_WriteLong },
+	{ 0x02004098, SIZE_LONG, DMA_Start_Read, DMA_Start_Write, DMA_Start_ReadLong, DMA_Start_WriteLong },
+	{ 0x0200409c, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write, DMA_Stop_ReadLong, DMA_Stop_WriteLong },
+	{ 0x02004290, SIZE_LONG, DMA_Init_Read, DMA_Init_Write, DMA_Init_ReadLong, DMA_Init_WriteLong },
 	
 	/* Channel SCC */
-	{ 0x020040c0, SIZE_LONG, DMA_Next_Read, DMA_Next_Write },
-	{ 0x020040c4, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write },
-	{ 0x020040c8, SIZE_LONG, DMA_Start_Read, DMA_Start_Write },
-	{ 0x020040cc, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write },
+	{ 0x020040c0, SIZE_LONG, DMA_Next_Read, DMA_Next_Write, DMA_Next_ReadLong, DMA_Next_WriteLong },
+	{ 0x020040c4, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write, DMA_Limit_ReadLong, DMA_Limit_WriteLong },
+	{ 0x020040c8, SIZE_LONG, DMA_Start_Read, DMA_Start_Write, DMA_Start_ReadLong, DMA_Start_WriteLong },
+	{ 0x020040cc, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write, DMA_Stop_ReadLong, DMA_Stop_WriteLong },
 	
 	/* Channel DSP */
-	{ 0x020040d0, SIZE_LONG, DMA_Next_Read, DMA_Next_Write },
-	{ 0x020040d4, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write },
-	{ 0x020040d8, SIZE_LONG, DMA_Start_Read, DMA_Start_Write },
-	{ 0x020040dc, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write },
-	{ 0x020042d0, SIZE_LONG, DMA_Init_Read, DMA_Init_Write },
+	{ 0x020040d0, SIZE_LONG, DMA_Next_Read, DMA_Next_Write, DMA_Next_ReadLong, DMA_Next_WriteLong },
+	{ 0x020040d4, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write, DMA_Limit_ReadLong, DMA_Limit_WriteLong },
+	{ 0x020040d8, SIZE_LONG, DMA_Start_Read, DMA_Start_Write, DMA_Start_ReadLong, DMA_Start_WriteLong },
+	{ 0x020040dc, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write, DMA_Stop_ReadLong, DMA_Stop_WriteLong },
+	{ 0x020042d0, SIZE_LONG, DMA_Init_Read, DMA_Init_Write, DMA_Init_ReadLong, DMA_Init_WriteLong },
 	
 	/* Channel Ethernet Transmit */
-	{ 0x02004100, SIZE_LONG, DMA_Saved_Next_Read, DMA_Saved_Next_Write },
-	{ 0x02004104, SIZE_LONG, DMA_Saved_Limit_Read, DMA_Saved_Limit_Write },
-	{ 0x02004108, SIZE_LONG, DMA_Saved_Start_Read, DMA_Saved_Start_Write },
-	{ 0x0200410c, SIZE_LONG, DMA_Saved_Stop_Read, DMA_Saved_Stop_Write },
-	{ 0x02004110, SIZE_LONG, DMA_Next_Read, DMA_Next_Write },
-	{ 0x02004114, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write },
-	{ 0x02004118, SIZE_LONG, DMA_Start_Read, DMA_Start_Write },
-	{ 0x0200411c, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write },
-	{ 0x02004310, SIZE_LONG, DMA_Init_Read, DMA_Init_Write },
+	{ 0x02004100, SIZE_LONG, DMA_Saved_Next_Read, DMA_Saved_Next_Write, DMA_Saved_Next_ReadLong, DMA_Saved_Next_WriteLong },
+	{ 0x02004104, SIZE_LONG, DMA_Saved_Limit_Read, DMA_Saved_Limit_Write, DMA_Saved_Limit_ReadLong, DMA_Saved_Limit_WriteLong },
+	{ 0x02004108, SIZE_LONG, DMA_Saved_Start_Read, DMA_Saved_Start_Write, DMA_Saved_Start_ReadLong, DMA_Saved_Start_WriteLong },
+	{ 0x0200410c, SIZE_LONG, DMA_Saved_Stop_Read, DMA_Saved_Stop_Write, DMA_Saved_Stop_ReadLong, DMA_Saved_Stop_WriteLong },
+	{ 0x02004110, SIZE_LONG, DMA_Next_Read, DMA_Next_Write, DMA_Next_ReadLong, DMA_Next_WriteLong },
+	{ 0x02004114, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write, DMA_Limit_ReadLong, DMA_Limit_WriteLong },
+	{ 0x02004118, SIZE_LONG, DMA_Start_Read, DMA_Start_Write, DMA_Start_ReadLong, DMA_Start_WriteLong },
+	{ 0x0200411c, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write, DMA_Stop_ReadLong, DMA_Stop_WriteLong },
+	{ 0x02004310, SIZE_LONG, DMA_Init_Read, DMA_Init_Write, DMA_Init_ReadLong, DMA_Init_WriteLong },
 	
 	/* Channel Ethernet Receive */
-	{ 0x02004140, SIZE_LONG, DMA_Saved_Next_Read, DMA_Saved_Next_Write },
-	{ 0x02004144, SIZE_LONG, DMA_Saved_Limit_Read, DMA_Saved_Limit_Write },
-	{ 0x02004148, SIZE_LONG, DMA_Saved_Start_Read, DMA_Saved_Start_Write },
-	{ 0x0200414c, SIZE_LONG, DMA_Saved_Stop_Read, DMA_Saved_Stop_Write },
-	{ 0x02004150, SIZE_LONG, DMA_Next_Read, DMA_Next_Write },
-	{ 0x02004154, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write },
-	{ 0x02004158, SIZE_LONG, DMA_Start_Read, DMA_Start_Write },
-	{ 0x0200415c, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write },
-	{ 0x02004350, SIZE_LONG, DMA_Init_Read, DMA_Init_Write },
+	{ 0x02004140, SIZE_LONG, DMA_Saved_Next_Read, DMA_Saved_Next_Write, DMA_Saved_Next_ReadLong, DMA_Saved_Next_WriteLong },
+	{ 0x02004144, SIZE_LONG, DMA_Saved_Limit_Read, DMA_Saved_Limit_Write, DMA_Saved_Limit_ReadLong, DMA_Saved_Limit_WriteLong },
+	{ 0x02004148, SIZE_LONG, DMA_Saved_Start_Read, DMA_Saved_Start_Write, DMA_Saved_Start_ReadLong, DMA_Saved_Start_WriteLong },
+	{ 0x0200414c, SIZE_LONG, DMA_Saved_Stop_Read, DMA_Saved_Stop_Write, DMA_Saved_Stop_ReadLong, DMA_Saved_Stop_WriteLong },
+	{ 0x02004150, SIZE_LONG, DMA_Next_Read, DMA_Next_Write, DMA_Next_ReadLong, DMA_Next_WriteLong },
+	{ 0x02004154, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write, DMA_Limit_ReadLong, DMA_Limit_WriteLong },
+	{ 0x02004158, SIZE_LONG, DMA_Start_Read, DMA_Start_Write, DMA_Start_ReadLong, DMA_Start_WriteLong },
+	{ 0x0200415c, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write, DMA_Stop_ReadLong, DMA_Stop_WriteLong },
+	{ 0x02004350, SIZE_LONG, DMA_Init_Read, DMA_Init_Write, DMA_Init_ReadLong, DMA_Init_WriteLong },
 	
 	/* Channel Video */
-	{ 0x02004180, SIZE_LONG, DMA_Next_Read, DMA_Next_Write }, /* Video scratch pad */
-	{ 0x02004184, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write },
-	{ 0x02004188, SIZE_LONG, DMA_Start_Read, DMA_Start_Write },
-	{ 0x0200418c, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write }, /* Event scratch pad */
+	{ 0x02004180, SIZE_LONG, DMA_Next_Read, DMA_Next_Write, DMA_Next_ReadLong, DMA_Next_WriteLong }, /* Video scratch pad */
+	{ 0x02004184, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write, DMA_Limit_ReadLong, DMA_Limit_WriteLong },
+	{ 0x02004188, SIZE_LONG, DMA_Start_Read, DMA_Start_Write, DMA_Start_ReadLong, DMA_Start_WriteLong },
+	{ 0x0200418c, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write, DMA_Stop_ReadLong, DMA_Stop_WriteLong }, /* Event scratch pad */
 	
 	/* Channel R2M */
-	{ 0x020041c0, SIZE_LONG, DMA_Next_Read, DMA_Next_Write },
-	{ 0x020041c4, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write },
-	{ 0x020041c8, SIZE_LONG, DMA_Start_Read, DMA_Start_Write },
-	{ 0x020041cc, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write },
-	{ 0x020043c0, SIZE_LONG, DMA_Init_Read, DMA_Init_Write },
+	{ 0x020041c0, SIZE_LONG, DMA_Next_Read, DMA_Next_Write, DMA_Next_ReadLong, DMA_Next_WriteLong },
+	{ 0x020041c4, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write, DMA_Limit_ReadLong, DMA_Limit_WriteLong },
+	{ 0x020041c8, SIZE_LONG, DMA_Start_Read, DMA_Start_Write, DMA_Start_ReadLong, DMA_Start_WriteLong },
+	{ 0x020041cc, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write, DMA_Stop_ReadLong, DMA_Stop_WriteLong },
+	{ 0x020043c0, SIZE_LONG, DMA_Init_Read, DMA_Init_Write, DMA_Init_ReadLong, DMA_Init_WriteLong },
 	
 	/* Channel M2R */
-	{ 0x020041d0, SIZE_LONG, DMA_Next_Read, DMA_Next_Write },
-	{ 0x020041d4, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write },
-	{ 0x020041d8, SIZE_LONG, DMA_Start_Read, DMA_Start_Write },
-	{ 0x020041dc, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write },
-	{ 0x020043d0, SIZE_LONG, DMA_Init_Read, DMA_Init_Write },
+	{ 0x020041d0, SIZE_LONG, DMA_Next_Read, DMA_Next_Write, DMA_Next_ReadLong, DMA_Next_WriteLong },
+	{ 0x020041d4, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write, DMA_Limit_ReadLong, DMA_Limit_WriteLong },
+	{ 0x020041d8, SIZE_LONG, DMA_Start_Read, DMA_Start_Write, DMA_Start_ReadLong, DMA_Start_WriteLong },
+	{ 0x020041dc, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write, DMA_Stop_ReadLong, DMA_Stop_WriteLong },
+	{ 0x020043d0, SIZE_LONG, DMA_Init_Read, DMA_Init_Write, DMA_Init_ReadLong, DMA_Init_WriteLong },
 	
 	/* Network Adapter (Fujitsu MB8795) */
 	{ 0x02006000, SIZE_BYTE, EN_TX_Status_Read, EN_TX_Status_Write },
@@ -175,8 +175,8 @@ const INTERCEPT_ACCESS_FUNC IoMemTable_NEXT[] =
 	{ 0x02006014, SIZE_BYTE, IoMem_ReadWithoutInterceptionButTrace, IoMem_WriteWithoutInterceptionButTrace },
 	
 	/* Interrupt Status and Mask Registers */
-	{ 0x02007000, SIZE_LONG, IntRegStatRead, IntRegStatWrite },
-	{ 0x02007800, SIZE_LONG, IntRegMaskRead, IntRegMaskWrite },
+	{ 0x02007000, SIZE_LONG, IntRegStatRead, IntRegStatWrite, IntRegStatReadLong, IntRegStatWriteLong },
+	{ 0x02007800, SIZE_LONG, IntRegMaskRead, IntRegMaskWrite, IntRegMaskReadLong, IntRegMaskWriteLong },
 	
 	/* DSP (Motorola XSP56001) */
 	{ 0x02008000, SIZE_BYTE, DSP_ICR_Read, DSP_ICR_Write },
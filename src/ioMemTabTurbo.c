@@ -47,58 +47,58 @@ const INTERCEPT_ACCESS_FUNC IoMemTable_Turbo[] =
 	{ 0x02000150, SIZE_LONG, TDMA_CSR_Read, TDMA_CSR_Write },
 	
 	/* Channel SCSI */
-	{ 0x02004010, SIZE_LONG, DMA_Next_Read, DMA_Next_Write },
-	{ 0x02004014, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write },
-	{ 0x02004018, SIZE_LONG, DMA_Start_Read, DMA_Start_Write },
-	{ 0x0200401c, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write },
+	{ 0x02004010, SIZE_LONG, DMA_Next_Read, DMA_Next_Write, DMA_Next_ReadLong, DMA_Next_WriteLong },
+	{ 0x02004014, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write, DMA_Limit_ReadLong, DMA_Limit_WriteLong },
+	{ 0x02004018, SIZE_LONG, DMA_Start_Read, DMA_Start_Write, DMA_Start_ReadLong, DMA_Start_WriteLong },
+	{ 0x0200401c, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write, DMA_Stop_ReadLong, DMA_Stop_WriteLong },
 	
 	/* Channel Sound out */
-	{ 0x02004040, SIZE_LONG, DMA_Next_Read, DMA_Next_Write },
-	{ 0x02004044, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write },
-	{ 0x02004048, SIZE_LONG, DMA_Start_Read, DMA_Start_Write },
-	{ 0x0200404c, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write },
+	{ 0x02004040, SIZE_LONG, DMA_Next_Read, DMA_Next_Write, DMA_Next_ReadLong, DMA_Next_WriteLong },
+	{ 0x02004044, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write, DMA_Limit_ReadLong, DMA_Limit_WriteLong },
+	{ 0x02004048, SIZE_LONG, DMA_Start_Read, DMA_Start_Write, DMA_Start_ReadLong, DMA_Start_WriteLong },
+	{ 0x0200404c, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write, DMA_Stop_ReadLong, DMA_Stop_WriteLong },
 	
 	/* Ethernet Saved Next */
 	{ 0x02004050, SIZE_LONG, TDMA_Saved_Next_Read, IoMem_WriteWithoutInterceptionButTrace },
 
 	/* Channel Sound in */
-	{ 0x02004080, SIZE_LONG, DMA_Next_Read, DMA_Next_Write },
-	{ 0x02004084, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write },
-	{ 0x02004088, SIZE_LONG, DMA_Start_Read, DMA_Start_Write },
-	{ 0x0200408c, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write },
+	{ 0x02004080, SIZE_LONG, DMA_Next_Read, DMA_Next_Write, DMA_Next_ReadLong, DMA_Next_WriteLong },
+	{ 0x02004084, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write, DMA_Limit_ReadLong, DMA_Limit_WriteLong },
+	{ 0x02004088, SIZE_LONG, DMA_Start_Read, DMA_Start_Write, DMA_Start_ReadLong, DMA_Start_WriteLong },
+	{ 0x0200408c, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write, DMA_Stop_ReadLong, DMA_Stop_WriteLong },
 	
 	/* Channel Printer */
-	{ 0x02004090, SIZE_LONG, DMA_Next_Read, DMA_Next_Write },
-	{ 0x02004094, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write },
-	{ 0x02004098, SIZE_LONG, DMA_Start_Read, DMA_Start_Write },
-	{ 0x0200409c, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write },
+	{ 0x02004090, SIZE_LONG, DMA_Next_Read, DMA_Next_Write, DMA_Next_ReadLong, DMA_Next_WriteLong },
+	{ 0x02004094, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write, DMA_Limit_ReadLong, DMA_Limit_WriteLong },
+	{ 0x02004098, SIZE_LONG, DMA_Start_Read, DMA_Start_Write, DMA_Start_ReadLong, DMA_Start_WriteLong },
+	{ 0x0200409c, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write, DMA_Stop_ReadLong, DMA_Stop_WriteLong },
 	
 	/* Channel DSP */
-	{ 0x020040d0, SIZE_LONG, DMA_Next_Read, DMA_Next_Write },
-	{ 0x020040d4, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write },
-	{ 0x020040d8, SIZE_LONG, DMA_Start_Read, DMA_Start_Write },
-	{ 0x020040dc, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write },
+	{ 0x020040d0, SIZE_LONG, DMA_Next_Read, DMA_Next_Write, DMA_Next_ReadLong, DMA_Next_WriteLong },
+	{ 0x020040d4, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write, DMA_Limit_ReadLong, DMA_Limit_WriteLong },
+	{ 0x020040d8, SIZE_LONG, DMA_Start_Read, DMA_Start_Write, DMA_Start_ReadLong, DMA_Start_WriteLong },
+	{ 0x020040dc, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write, DMA_Stop_ReadLong, DMA_Stop_WriteLong },
 	
 	/* Channel Ethernet Transmit */
-	{ 0x02004110, SIZE_LONG, DMA_Next_Read, DMA_Next_Write },
-	{ 0x02004114, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write },
-	{ 0x02004118, SIZE_LONG, DMA_Start_Read, DMA_Start_Write },
-	{ 0x0200411c, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write },
+	{ 0x02004110, SIZE_LONG, DMA_Next_Read, DMA_Next_Write, DMA_Next_ReadLong, DMA_Next_WriteLong },
+	{ 0x02004114, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write, DMA_Limit_ReadLong, DMA_Limit_WriteLong },
+	{ 0x02004118, SIZE_LONG, DMA_Start_Read, DMA_Start_Write, DMA_Start_ReadLong, DMA_Start_WriteLong },
+	{ 0x0200411c, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write, DMA_Stop_ReadLong, DMA_Stop_WriteLong },
 	
 	/* Channel Ethernet Receive */
-	{ 0x02004150, SIZE_LONG, DMA_Next_Read, DMA_Next_Write },
-	{ 0x02004154, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write },
-	{ 0x02004158, SIZE_LONG, DMA_Start_Read, DMA_Start_Write },
-	{ 0x0200415c, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write },
+	{ 0x02004150, SIZE_LONG, DMA_Next_Read, DMA_Next_Write, DMA_Next_ReadLong, DMA_Next_WriteLong },
+	{ 0x02004154, SIZE_LONG, DMA_Limit_Read, DMA_Limit_Write, DMA_Limit_ReadLong, DMA_Limit_WriteLong },
+	{ 0x02004158, SIZE_LONG, DMA_Start_Read, DMA_Start_Write, DMA_Start_ReadLong, DMA_Start_WriteLong },
+	{ 0x0200415c, SIZE_LONG, DMA_Stop_Read, DMA_Stop_Write, DMA_Stop_ReadLong, DMA_Stop_WriteLong },
 	
 	/* DMA Init */
-	{ 0x02004210, SIZE_LONG, DMA_Init_Read, DMA_Init_Write },
-	{ 0x02004240, SIZE_LONG, DMA_Init_Read, DMA_Init_Write },
-	{ 0x02004280, SIZE_LONG, DMA_Init_Read, DMA_Init_Write },
-	{ 0x02004290, SIZE_LONG, DMA_Init_Read, DMA_Init_Write },
-	{ 0x020042d0, SIZE_LONG, DMA_Init_Read, DMA_Init_Write },
-	{ 0x02004310, SIZE_LONG, DMA_Init_Read, DMA_Init_Write },
-	{ 0x02004350, SIZE_LONG, DMA_Init_Read, DMA_Init_Write },
+	{ 0x02004210, SIZE_LONG, DMA_Init_Read, DMA_Init_Write, DMA_Init_ReadLong, DMA_Init_WriteLong },
+	{ 0x02004240, SIZE_LONG, DMA_Init_Read, DMA_Init_Write, DMA_Init_ReadLong, DMA_Init_WriteLong },
+	{ 0x02004280, SIZE_LONG, DMA_Init_Read, DMA_Init_Write, DMA_Init_ReadLong, DMA_Init_WriteLong },
+	{ 0x02004290, SIZE_LONG, DMA_Init_Read, DMA_Init_Write, DMA_Init_ReadLong, DMA_Init_WriteLong },
+	{ 0x020042d0, SIZE_LONG, DMA_Init_Read, DMA_Init_Write, DMA_Init_ReadLong, DMA_Init_WriteLong },
+	{ 0x02004310, SIZE_LONG, DMA_Init_Read, DMA_Init_Write, DMA_Init_ReadLong, DMA_Init_WriteLong },
+	{ 0x02004350, SIZE_LONG, DMA_Init_Read, DMA_Init_Write, DMA_Init_ReadLong, DMA_Init_WriteLong },
 	
 	/* Network Adapter (AT&T 7213) */
 	{ 0x02006000, SIZE_BYTE, EN_TX_Status_Read, EN_TX_Status_Write },
@@ -119,8 +119,8 @@ const INTERCEPT_ACCESS_FUNC IoMemTable_Turbo[] =
 	{ 0x0200600f, SIZE_BYTE, IoMem_ReadWithoutInterceptionButTrace, IoMem_WriteWithoutInterceptionButTrace },
 	
 	/* Interrupt Status and Mask Registers */
-	{ 0x02007000, SIZE_LONG, IntRegStatRead, IntRegStatWrite },
-	{ 0x02007800, SIZE_LONG, IntRegMaskRead, IntRegMaskWrite },
+	{ 0x02007000, SIZE_LONG, IntRegStatRead, IntRegStatWrite, IntRegStatReadLong, IntRegStatWriteLong },
+	{ 0x02007800, SIZE_LONG, IntRegMaskRead, IntRegMaskWrite, IntRegMaskReadLong, IntRegMaskWriteLong },
 	
 	/* DSP (Motorola XSP56001) */
 	{ 0x02008000, SIZE_BYTE, DSP_ICR_Read, DSP_ICR_Write },
@@ -16,6 +16,8 @@ const char M68000_fileid[] = "Hatari m68000.c : " __DATE__ " " __TIME__;
 #include "m68000.h"
 #include "options.h"
 #include "nextMemory.h"
+#include "dsp.h"
+#include "dimension.h"
 
 #include "mmu_common.h"
 
@@ -29,6 +31,8 @@ int LastInstrCycles = 0;	/* number of cycles for previous instr. (not rounded to
 int Pairing = 0;		/* set to 1 if the latest 2 intr paired */
 char PairingArray[ MAX_OPCODE_FAMILY ][ MAX_OPCODE_FAMILY ];
 
+int nCoprocCycles = 0;		/* CPU cycles DSP and i860 are behind the CPU */
+
 
 /* to convert the enum from OpcodeFamily to a readable value for pairing's debug */
 const char *OpcodeName[] = { "ILLG",
@@ -149,6 +153,7 @@ static int pendingInterrupts = 0;
  */
 void M68000_Reset(bool bCold) {
     pendingInterrupts = 0;
+    nCoprocCycles = 0;
     if (bCold) {
         /* Clear registers, but we need to keep SPCFLAG_MODE_CHANGE and SPCFLAG_BRK unchanged */
         int spcFlags = regs.spcflags & (SPCFLAG_MODE_CHANGE | SPCFLAG_BRK);
@@ -161,6 +166,22 @@ void M68000_Reset(bool bCold) {
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Run DSP and i860 for the CPU cycles accumulated since the last sync.
+ * Called when a quantum is full and before the CPU accesses the DSP host
+ * port or the NeXTdimension board.
+ */
+void M68000_SyncCoprocessors(void) {
+    int cycles = nCoprocCycles;
+    if (cycles <= 0)
+        return;
+    nCoprocCycles = 0;
+    DSP_Run(cycles);
+    i860_Run(cycles);
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Stop 680x0 emulation
@@ -208,6 +229,26 @@ void M68000_CheckCpuSettings(void)
         } else {
             ConfigureParams.System.nCpuFreq = 33;
         }
+    }
+    if (ConfigureParams.System.nCoprocQuantum < 1)
+    {
+        ConfigureParams.System.nCoprocQuantum = 1;
+    }
+    else if (ConfigureParams.System.nCoprocQuantum > 4096)
+    {
+        ConfigureParams.System.nCoprocQuantum = 4096;
+    }
+    if (ConfigureParams.System.nSpeedTarget < 0)
+    {
+        ConfigureParams.System.nSpeedTarget = 0;
+    }
+    else if (ConfigureParams.System.nSpeedTarget > 0 && ConfigureParams.System.nSpeedTarget < 10)
+    {
+        ConfigureParams.System.nSpeedTarget = 10;
+    }
+    else if (ConfigureParams.System.nSpeedTarget > 10000)
+    {
+        ConfigureParams.System.nSpeedTarget = 10000;
     }
 	changed_prefs.cpu_level = ConfigureParams.System.nCpuLevel;
 	changed_prefs.cpu_compatible = ConfigureParams.System.bCompatibleCpu;
@@ -61,7 +61,9 @@ typedef struct {
 
 static double lastRT;
 static Uint64 lastCycles;
+static double lastIdle;
 static double speedFactor;
+static double idleFactor;
 static char   speedMsg[32];
 
 void Main_Speed(double realTime, double hostTime) {
@@ -70,8 +72,10 @@ void Main_Speed(double realTime, double hostTime) {
     speedFactor /= ConfigureParams.System.nCpuFreq;
     speedFactor /= 1000 * 1000;
     speedFactor /= dRT;
+    idleFactor  = (host_idle_sec() - lastIdle) / dRT;
     lastRT     = realTime;
     lastCycles = nCyclesMainCounter;
+    lastIdle   = host_idle_sec();
 }
 
 void Main_SpeedReset(void) {
@@ -79,12 +83,17 @@ void Main_SpeedReset(void) {
     host_time(&realTime, &hostTime);
     lastRT     = realTime;
     lastCycles = nCyclesMainCounter;
+    lastIdle   = host_idle_sec();
 }
 
 const char* Main_SpeedMsg() {
     speedMsg[0] = 0;
     if(speedFactor > 0) {
-        if(ConfigureParams.System.bRealtime) {
+        if(ConfigureParams.System.bRealtime && ConfigureParams.System.nSpeedTarget && idleFactor < 1) {
+            /* show the headroom left by the speed governor */
+            sprintf(speedMsg, "%dMHz+%d%%/", (int)(ConfigureParams.System.nCpuFreq * speedFactor + 0.5),
+                    (int)(100 * idleFactor / (1 - idleFactor) + 0.5));
+        } else if(ConfigureParams.System.bRealtime) {
             sprintf(speedMsg, "%dMHz/", (int)(ConfigureParams.System.nCpuFreq * speedFactor + 0.5));
         } else {
             if ((speedFactor < 0.8) || (speedFactor > 1.1))
@@ -101,6 +110,7 @@ static const report_t reports[] = {
     {"Speed", Main_Speed},
     {"ND",    nd_reports},
     {"Host",  host_report},
+    {"CycInt",CycInt_Report},
 };
 #endif
 
@@ -285,9 +295,13 @@ void Main_EventHandler(void) {
         
         if ( bEmulationActive || remotepause ) {
             double time_offset = host_real_time_offset() * 1000;
-            if(time_offset > 10)
+            if(time_offset > 10) {
+                double rt, vt, start;
+                host_time(&start, &vt);
                 events = SDL_WaitEventTimeout(&event, time_offset);
-            else
+                host_time(&rt, &vt);
+                host_idle_us((rt - start) * 1000 * 1000);
+            } else
                 events = SDL_PollEvent(&event);
         }
         else {
@@ -15,9 +15,14 @@ const char STMemory_fileid[] = "Previous nextMemory.c : " __DATE__ " " __TIME__;
 #include "memory.h"
 
 /*
- * Main RAM buffer (128 MB for turbo systems)
+ * Main RAM buffer (128 MB for turbo systems). Long aligned for the host
+ * order layout in maccess.h.
  */
-Uint8 NEXTRam[128*1024*1024];
+#ifdef _MSC_VER
+__declspec(align(4)) Uint8 NEXTRam[128*1024*1024];
+#else
+Uint8 NEXTRam[128*1024*1024] __attribute__ ((aligned (4)));
+#endif
 
 Uint32 NEXTRamEnd;
 
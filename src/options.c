@@ -49,6 +49,8 @@ enum {
 	OPT_GRAB,
 	OPT_STATUSBAR,
 	OPT_DRIVE_LED,
+	OPT_VSYNC_LOCK,
+	OPT_VSYNC_TOLERANCE,
 	OPT_PRINTER,
 	OPT_WRITEPROT_HD,
 	OPT_MEMSIZE,		/* memory options */
@@ -65,6 +67,14 @@ enum {
 
 	OPT_MACHINE,		/* system options */
 	OPT_REALTIME,
+	OPT_IDLEWARP,
+	OPT_THREADEDDISPATCH,
+	OPT_COPROCQUANTUM,
+	OPT_SPEEDTARGET,
+	OPT_SCHED,
+	OPT_SCHED_PRIORITY,
+	OPT_AFFINITY,
+	OPT_MLOCK,
 	OPT_DSP,
 	OPT_MICROPHONE,
 	OPT_SOUND,
@@ -120,6 +130,10 @@ static const opt_t HatariOptions[] = {
 	  "<bool>", "Show statusbar (floppy leds etc)" },
 	{ OPT_DRIVE_LED,   NULL, "--drive-led",
 	  "<bool>", "Show overlay drive led when statusbar isn't shown" },
+	{ OPT_VSYNC_LOCK, NULL, "--vsync-lock",
+	  "<bool>", "Lock the VBL to the host display's vsync" },
+	{ OPT_VSYNC_TOLERANCE, NULL, "--vsync-tolerance",
+	  "<x>", "Max. refresh rate deviation for vsync lock (x = 0-50%)" },
 
 	{ OPT_HEADER, NULL, NULL, NULL, "Devices" },
 	{ OPT_PRINTER,   NULL, "--printer",
@@ -158,6 +172,22 @@ static const opt_t HatariOptions[] = {
 	{ OPT_HEADER, NULL, NULL, NULL, "Misc system" },
 	{ OPT_REALTIME,   NULL, "--realtime",
 	  "<bool>", "Use host realtime sources" },
+	{ OPT_IDLEWARP,   NULL, "--idle-warp",
+	  "<bool>", "Skip idle CPU time in cycle-time mode" },
+	{ OPT_THREADEDDISPATCH, NULL, "--threaded-dispatch",
+	  "<bool>", "Use threaded 68030 instruction dispatch (if built in)" },
+	{ OPT_COPROCQUANTUM, NULL, "--coproc-quantum",
+	  "<x>", "CPU cycles between DSP/i860 updates (x = 1-4096)" },
+	{ OPT_SPEEDTARGET, NULL, "--speed-target",
+	  "<x>", "Realtime speed in percent of CPU clock (x = 0 (unlimited), 10-10000)" },
+	{ OPT_SCHED,     NULL, "--sched",
+	  "<x>", "Host scheduling policy (x = other/fifo/rr)" },
+	{ OPT_SCHED_PRIORITY, NULL, "--sched-priority",
+	  "<x>", "Host priority for fifo/rr scheduling (x = 1-99)" },
+	{ OPT_AFFINITY,  NULL, "--affinity",
+	  "<list>", "Host cores for cpu,i860,render,audio,slirp threads (-1 = any)" },
+	{ OPT_MLOCK,     NULL, "--mlock",
+	  "<bool>", "Lock emulator memory into host RAM" },
 	{ OPT_DSP,       NULL, "--dsp",
 	  "<x>", "DSP emulation (x = none/dummy/emu)" },
 	{ OPT_MICROPHONE,   NULL, "--mic",
@@ -732,6 +762,19 @@ bool Opt_ParseParameters(int argc, const char * const argv[])
 		case OPT_DRIVE_LED:
 			ok = Opt_Bool(argv[++i], OPT_DRIVE_LED, &ConfigureParams.Screen.bShowDriveLed);
 			break;
+
+		case OPT_VSYNC_LOCK:
+			ok = Opt_Bool(argv[++i], OPT_VSYNC_LOCK, &ConfigureParams.Screen.bVsyncLock);
+			break;
+
+		case OPT_VSYNC_TOLERANCE:
+			temp = atoi(argv[++i]);
+			if (temp < 0 || temp > 50)
+			{
+				return Opt_ShowError(OPT_VSYNC_TOLERANCE, argv[i], "Invalid tolerance");
+			}
+			ConfigureParams.Screen.nVsyncTolerance = temp;
+			break;
 									
 		case OPT_PRINTER:
 			i += 1;
@@ -824,6 +867,79 @@ bool Opt_ParseParameters(int argc, const char * const argv[])
 		case OPT_REALTIME:
 			ok = Opt_Bool(argv[++i], OPT_REALTIME, &ConfigureParams.System.bRealtime);
 			break;
+
+		case OPT_IDLEWARP:
+			ok = Opt_Bool(argv[++i], OPT_IDLEWARP, &ConfigureParams.System.bIdleWarp);
+			break;
+
+		case OPT_THREADEDDISPATCH:
+			ok = Opt_Bool(argv[++i], OPT_THREADEDDISPATCH, &ConfigureParams.System.bThreadedDispatch);
+			break;
+
+		case OPT_COPROCQUANTUM:
+			temp = atoi(argv[++i]);
+			if (temp < 1 || temp > 4096)
+			{
+				return Opt_ShowError(OPT_COPROCQUANTUM, argv[i], "Invalid quantum");
+			}
+			ConfigureParams.System.nCoprocQuantum = temp;
+			break;
+
+		case OPT_SPEEDTARGET:
+			temp = atoi(argv[++i]);
+			if (temp != 0 && (temp < 10 || temp > 10000))
+			{
+				return Opt_ShowError(OPT_SPEEDTARGET, argv[i], "Invalid speed target");
+			}
+			ConfigureParams.System.nSpeedTarget = temp;
+			break;
+
+		case OPT_SCHED:
+			i += 1;
+			if (strcasecmp(argv[i], "other") == 0)
+				ConfigureParams.System.nSchedPolicy = SCHED_POLICY_OTHER;
+			else if (strcasecmp(argv[i], "fifo") == 0)
+				ConfigureParams.System.nSchedPolicy = SCHED_POLICY_FIFO;
+			else if (strcasecmp(argv[i], "rr") == 0)
+				ConfigureParams.System.nSchedPolicy = SCHED_POLICY_RR;
+			else
+				return Opt_ShowError(OPT_SCHED, argv[i], "Unknown scheduling policy");
+			break;
+
+		case OPT_SCHED_PRIORITY:
+			temp = atoi(argv[++i]);
+			if (temp < 1 || temp > 99)
+			{
+				return Opt_ShowError(OPT_SCHED_PRIORITY, argv[i], "Invalid priority");
+			}
+			ConfigureParams.System.nSchedPriority = temp;
+			break;
+
+		case OPT_AFFINITY:
+			{
+				const char *list = argv[++i];
+				char *end;
+				int n;
+				for (n = 0; n < THREAD_COUNT && *list; n++)
+				{
+					temp = strtol(list, &end, 10);
+					if (end == list || temp < -1 || (*end && *end != ','))
+					{
+						return Opt_ShowError(OPT_AFFINITY, argv[i], "Invalid core list");
+					}
+					ConfigureParams.System.nThreadCore[n] = temp;
+					list = *end ? end + 1 : end;
+				}
+				if (*list)
+				{
+					return Opt_ShowError(OPT_AFFINITY, argv[i], "Too many cores in list");
+				}
+			}
+			break;
+
+		case OPT_MLOCK:
+			ok = Opt_Bool(argv[++i], OPT_MLOCK, &ConfigureParams.System.bLockMemory);
+			break;
 						
 		case OPT_RTC:
 			ok = Opt_Bool(argv[++i], OPT_RTC, &ConfigureParams.System.bRealTimeClock);
@@ -31,6 +31,9 @@ static Uint8 scr2_3=0x00;
 
 static Uint32 intStat=0x00000000;
 static Uint32 intMask=0x00000000;
+static int    intLevel=0;
+
+static void update_interrupt_level(void);
 
 
 
@@ -103,6 +106,7 @@ void SCR_Reset(void) {
 	
     intStat=0x00000000;
     intMask=0x00000000;
+    update_interrupt_level();
 
     if (ConfigureParams.System.bTurbo) {
         scr1 = SCR1_TURBO;
@@ -294,6 +298,7 @@ void SCR2_Write2(void)
 	if ((old_scr2_2&SCR2_TIMERIPL7)!=(scr2_2&SCR2_TIMERIPL7)) {
 		Log_Printf(LOG_WARN,"SCR2 TIMER IPL7 change at $%08x val=%x PC=$%08x\n",
                            IoAccessCurrentAddress,scr2_2&SCR2_TIMERIPL7,m68k_getpc());
+		update_interrupt_level();
 	}
 
     /* RTC enabled */
@@ -355,12 +360,21 @@ void SCR2_Read3(void)
 
 /* Interrupt Status Register */
 
+Uint32 IntRegStatReadLong(Uint32 addr) {
+    return intStat;
+}
+
+void IntRegStatWriteLong(Uint32 addr, Uint32 val) {
+    intStat = val;
+    update_interrupt_level();
+}
+
 void IntRegStatRead(void) {
-    IoMem_WriteLong(IoAccessCurrentAddress & IO_SEG_MASK, intStat);
+    IoMem_WriteLong(IoAccessCurrentAddress & IO_SEG_MASK, IntRegStatReadLong(IoAccessCurrentAddress));
 }
 
 void IntRegStatWrite(void) {
-    intStat = IoMem_ReadLong(IoAccessCurrentAddress & IO_SEG_MASK);
+    IntRegStatWriteLong(IoAccessCurrentAddress, IoMem_ReadLong(IoAccessCurrentAddress & IO_SEG_MASK));
 }
 
 void set_dsp_interrupt(Uint8 state) {
@@ -372,17 +386,19 @@ void set_dsp_interrupt(Uint8 state) {
 }
 
 void set_interrupt(Uint32 intr, Uint8 state) {
-    /* The interrupt gets polled by the cpu via intlev()
-     * --> see previous-glue.c
+    /* The cpu gets notified about a new interrupt level via
+     * SPCFLAG_IPL_CHANGE and then reads it via intlev()
+     * --> see hatari-glue.c
      */
     if (state==SET_INT) {
         intStat |= intr;
     } else {
         intStat &= ~intr;
     }
+    update_interrupt_level();
 }
 
-int get_interrupt_level(void) {
+static int interrupt_level(void) {
     Uint32 interrupt = intStat&intMask;
     
     if (!interrupt) {
@@ -408,15 +424,37 @@ int get_interrupt_level(void) {
     }
 }
 
+static void update_interrupt_level(void) {
+    int level = interrupt_level();
+    
+    if (level != intLevel) {
+        intLevel = level;
+        M68000_SetSpecial(SPCFLAG_IPL_CHANGE);
+    }
+}
+
+int get_interrupt_level(void) {
+    return intLevel;
+}
+
 /* Interrupt Mask Register */
 
+Uint32 IntRegMaskReadLong(Uint32 addr) {
+	return intMask;
+}
+
+void IntRegMaskWriteLong(Uint32 addr, Uint32 val) {
+	intMask = val;
+        Log_Printf(LOG_DEBUG,"Interrupt mask: %08x", intMask);
+    update_interrupt_level();
+}
+
 void IntRegMaskRead(void) {
-	IoMem_WriteLong(IoAccessCurrentAddress & IO_SEG_MASK,intMask);
+	IoMem_WriteLong(IoAccessCurrentAddress & IO_SEG_MASK, IntRegMaskReadLong(IoAccessCurrentAddress));
 }
 
 void IntRegMaskWrite(void) {
-	intMask = IoMem_ReadLong(IoAccessCurrentAddress & IO_SEG_MASK);
-        Log_Printf(LOG_DEBUG,"Interrupt mask: %08x", intMask);
+	IntRegMaskWriteLong(IoAccessCurrentAddress, IoMem_ReadLong(IoAccessCurrentAddress & IO_SEG_MASK));
 }
 
 
@@ -60,6 +60,32 @@ static void Video_InterruptHandler(void) {
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Microseconds until the next VBL. If the VBL is locked to vsync and the
+ * host refresh rate is within the configured tolerance of the NeXT refresh
+ * rate, the next VBL is aligned with the next host vsync. Vsync is measured
+ * in real time, so this only applies while the host clock follows it.
+ */
+static Uint64 Video_NextVBL(void) {
+    Uint64 period = (1000*1000)/NEXT_VBL_FREQ;
+    Uint64 vsync, hostPeriod, now, next;
+    
+    if (!ConfigureParams.Screen.bVsyncLock || !host_time_is_real() ||
+        !Screen_GetVsync(&vsync, &hostPeriod))
+        return period;
+    if (hostPeriod * 100 < period * (100 - ConfigureParams.Screen.nVsyncTolerance) ||
+        hostPeriod * 100 > period * (100 + ConfigureParams.Screen.nVsyncTolerance))
+        return period;
+    
+    /* Skip to the first vsync at least half a period ahead */
+    now  = host_real_time_us();
+    next = vsync + hostPeriod;
+    if (next < now + hostPeriod / 2)
+        next += ((now + hostPeriod / 2 - next) / hostPeriod + 1) * hostPeriod;
+    return next - now;
+}
+
 /*-----------------------------------------------------------------------*/
 /**
  * VBL interrupt : set new interrupts, draw screen, generate sound,
@@ -72,7 +98,8 @@ void Video_InterruptHandler_VBL ( void ) {
     if(statusBarToggle) Update_StatusBar();
     statusBarToggle = !statusBarToggle;
     Video_InterruptHandler();
-    CycInt_AddRelativeInterruptUs((1000*1000)/NEXT_VBL_FREQ, INTERRUPT_VIDEO_VBL);
+    if (ConfigureParams.Screen.bVsyncLock) Screen_FrameReady();
+    CycInt_AddRelativeInterruptUs(Video_NextVBL(), INTERRUPT_VIDEO_VBL);
 }
 
 